@@ -0,0 +1,393 @@
+#include "ChebyshevProxy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+/* Samples f at the n + 1 Chebyshev points x_j = cos(j pi / n), mapped to [a, b], and computes
+ * the coefficients of the interpolant. When n is doubled the previous points are a subset of
+ * the new ones, hence only the new samples are evaluated.
+ * The interpolant is chopped after the last coefficient above tol * max|c_k|.
+ */
+void ChebyshevProxy::interpolate()
+{
+    const double center = 0.5 * (a_ + b_);
+    const double radius = 0.5 * (b_ - a_);
+    unsigned int n = 16u;
+    std::vector<double> samples;
+
+    while (true)
+    {
+        std::vector<double> newSamples(n + 1);
+        for (unsigned int j = 0; j <= n; ++j)
+        {
+            if (!samples.empty() && j % 2 == 0)
+                newSamples[j] = samples[j / 2];
+            else
+            {
+                newSamples[j] = f_(center + radius * std::cos(M_PI * j / n));
+                ++evaluations_;
+            }
+        }
+        samples = std::move(newSamples);
+
+        std::vector<double> c(n + 1, 0.);
+        for (unsigned int k = 0; k <= n; ++k)
+        {
+            double sum = 0.5 * (samples[0] + samples[n] * (k % 2 == 0 ? 1. : -1.));
+            for (unsigned int j = 1; j < n; ++j)
+                sum += samples[j] * std::cos(M_PI * ((j * k) % (2 * n)) / n);
+            c[k] = 2. * sum / n;
+        }
+        c[0] *= 0.5;
+        c[n] *= 0.5;
+
+        double scale = 0.;
+        for (auto ck : c)
+            scale = std::max(scale, std::abs(ck));
+        const double cutoff = tol_ * scale;
+
+        if (std::max(std::abs(c[n]), std::abs(c[n - 1])) <= cutoff)
+        {
+            unsigned int degree = n;
+            while (degree > 0 && std::abs(c[degree]) <= cutoff)
+                --degree;
+            c.resize(degree + 1);
+            coefficients_ = std::move(c);
+            return;
+        }
+
+        if (2 * n > maxDegree_)
+            throw std::overflow_error("The Chebyshev coefficients did not decay within the maximum degree!");
+        n *= 2;
+    }
+}
+
+// Derivative of the interpolant with respect to t in [-1, 1], T'_k = k U_{k-1}
+double ChebyshevProxy::derivative(double t) const
+{
+    double result = 0.;
+    double uPrev = 0.;
+    double u = 1.;
+    for (unsigned int k = 1; k < coefficients_.size(); ++k)
+    {
+        result += k * coefficients_[k] * u;
+        double uNext = 2. * t * u - uPrev;
+        uPrev = u;
+        u = uNext;
+    }
+    return result;
+}
+
+std::vector<SolverTraits::VariableType> ChebyshevProxy::solveAll()
+{
+    evaluations_ = 0u;
+    interpolate();
+
+    const auto &c = coefficients_;
+    const unsigned int n = c.size() - 1;
+    std::vector<double> t;
+    // only the real roots in [-1, 1] are roots of f in [a, b]
+    constexpr double slack = 1e-8;
+    auto accept = [&t, slack](double re, double im)
+    {
+        if (std::abs(im) <= slack && std::abs(re) <= 1. + slack)
+            t.push_back(std::clamp(re, -1., 1.));
+    };
+
+    if (n == 1)
+        accept(-c[0] / c[1], 0.);
+    else if (n > 1)
+    {
+        // Transpose of the colleague matrix, which is upper Hessenberg
+        std::vector<double> H(n * n, 0.);
+        H[1 * n + 0] = 1.;
+        for (unsigned int k = 1; k < n; ++k)
+        {
+            H[(k - 1) * n + k] = 0.5;
+            if (k + 1 < n)
+                H[(k + 1) * n + k] = 0.5;
+        }
+        for (unsigned int k = 0; k < n; ++k)
+            H[k * n + (n - 1)] -= c[k] / (2. * c[n]);
+
+        std::vector<double> wr, wi;
+        hessenbergEigenvalues(std::move(H), n, wr, wi);
+
+        for (unsigned int i = 0; i < n; ++i)
+            accept(wr[i], wi[i]);
+    }
+
+    // Polishing with a single Newton step
+    const double center = 0.5 * (a_ + b_);
+    const double radius = 0.5 * (b_ - a_);
+    std::vector<T::VariableType> roots;
+    for (auto ti : t)
+    {
+        T::VariableType x = center + radius * ti;
+        T::ReturnType y = f_(x);
+        ++evaluations_;
+        double dy = df_ ? df_(x) : derivative(ti) / radius;
+        if (y != 0 && dy != 0)
+        {
+            T::VariableType x1 = x - y / dy;
+            if (std::min(a_, b_) <= x1 && x1 <= std::max(a_, b_))
+                x = x1;
+        }
+        roots.push_back(x);
+    }
+
+    std::sort(roots.begin(), roots.end());
+    return roots;
+}
+
+SolverTraits::VariableType ChebyshevProxy::solve()
+{
+    auto roots = solveAll();
+    if (roots.empty())
+        throw std::invalid_argument("The function has no zero in the provided interval!");
+    report_ = {roots.front(), std::numeric_limits<T::ReturnType>::quiet_NaN(), 0u};
+    return report_.root;
+}
+
+namespace
+{
+    /* Balancing: a similarity by a diagonal matrix of powers of 2, so without rounding errors,
+     * that makes the norms of each row and of the corresponding column comparable. The rounding
+     * errors of the eigenvalues are proportional to the norm of the matrix, which is reduced.
+     * A diagonal similarity keeps the matrix upper Hessenberg.
+     */
+    void balance(std::vector<double> &H, unsigned int n)
+    {
+        bool balanced = false;
+        while (!balanced)
+        {
+            balanced = true;
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                double column = 0., row = 0.;
+                for (unsigned int j = 0; j < n; ++j)
+                    if (j != i)
+                    {
+                        column += std::abs(H[j * n + i]);
+                        row += std::abs(H[i * n + j]);
+                    }
+                if (column == 0. || row == 0.)
+                    continue;
+                // the power of 2 closest to sqrt(row / column) equalizes the two norms
+                double scale = std::exp2(std::round(0.5 * std::log2(row / column)));
+                if (column * scale + row / scale < 0.95 * (column + row))
+                {
+                    balanced = false;
+                    for (unsigned int j = 0; j < n; ++j)
+                    {
+                        H[i * n + j] /= scale;
+                        H[j * n + i] *= scale;
+                    }
+                }
+            }
+        }
+    }
+
+    // Householder reflector I - beta v v^T, of size m = 2 or 3, that maps u to a multiple of e_1
+    struct Reflector
+    {
+        unsigned int m;
+        double v[3];
+        double beta;
+    };
+
+    Reflector reflector(unsigned int m, double u0, double u1, double u2 = 0.)
+    {
+        Reflector P{m, {u0, u1, u2}, 0.};
+        // the reflector does not depend on the scale of u, which avoids overflows
+        double scale = std::max({std::abs(u0), std::abs(u1), std::abs(u2)});
+        if (scale == 0.)
+            return P;
+        double squares = 0.;
+        for (auto &v : P.v)
+        {
+            v /= scale;
+            squares += v * v;
+        }
+        // the sign avoids the cancellation in v_0, and then v^T v = 2 |u| (|u| + |u_0|)
+        double norm = std::sqrt(squares);
+        double first = std::abs(P.v[0]);
+        P.v[0] += std::copysign(norm, P.v[0]);
+        P.beta = 1. / (norm * (norm + first));
+        return P;
+    }
+
+    // H = P H on the rows first, ..., first + m - 1 and the columns from begin to end
+    void applyLeft(std::vector<double> &H, unsigned int n, const Reflector &P,
+                   unsigned int first, unsigned int begin, unsigned int end)
+    {
+        for (unsigned int j = begin; j <= end; ++j)
+        {
+            double dot = 0.;
+            for (unsigned int r = 0; r < P.m; ++r)
+                dot += P.v[r] * H[(first + r) * n + j];
+            dot *= P.beta;
+            for (unsigned int r = 0; r < P.m; ++r)
+                H[(first + r) * n + j] -= dot * P.v[r];
+        }
+    }
+
+    // H = H P on the columns first, ..., first + m - 1 and the rows from begin to end
+    void applyRight(std::vector<double> &H, unsigned int n, const Reflector &P,
+                    unsigned int first, unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i <= end; ++i)
+        {
+            double dot = 0.;
+            for (unsigned int c = 0; c < P.m; ++c)
+                dot += H[i * n + first + c] * P.v[c];
+            dot *= P.beta;
+            for (unsigned int c = 0; c < P.m; ++c)
+                H[i * n + first + c] -= dot * P.v[c];
+        }
+    }
+
+    /* Francis double shift QR step on the unreduced block of rows and columns lo, ..., hi
+     * (Golub and Van Loan, Matrix Computations, section 7.5): implicitly, the step of the QR
+     * iteration with the shifts whose sum is s and whose product is t. The first column of
+     * (H - s1 I)(H - s2 I) = H^2 - s H + t I has three nonzero entries: the reflector that
+     * zeroes two of them creates a bulge below the subdiagonal, which the following reflectors
+     * chase down to the last row. Only the block is updated, since the rest of the matrix does
+     * not change its eigenvalues.
+     */
+    void francisStep(std::vector<double> &H, unsigned int n, unsigned int lo, unsigned int hi, double s, double t)
+    {
+        auto h = [&H, n](unsigned int i, unsigned int j)
+        { return H[i * n + j]; };
+        double x = h(lo, lo) * h(lo, lo) + h(lo, lo + 1) * h(lo + 1, lo) - s * h(lo, lo) + t;
+        double y = h(lo + 1, lo) * (h(lo, lo) + h(lo + 1, lo + 1) - s);
+        double z = h(lo + 1, lo) * h(lo + 2, lo + 1);
+        for (unsigned int k = lo; k + 2 <= hi; ++k)
+        {
+            Reflector P = reflector(3, x, y, z);
+            unsigned int begin = k > lo ? k - 1 : lo;
+            applyLeft(H, n, P, k, begin, hi);
+            applyRight(H, n, P, k, lo, std::min(k + 3, hi));
+            // the bulge has moved one column to the right
+            if (k > lo)
+                H[(k + 1) * n + k - 1] = H[(k + 2) * n + k - 1] = 0.;
+            x = h(k + 1, k);
+            y = h(k + 2, k);
+            z = k + 3 <= hi ? h(k + 3, k) : 0.;
+        }
+        Reflector P = reflector(2, x, y);
+        applyLeft(H, n, P, hi - 1, hi - 2, hi);
+        applyRight(H, n, P, hi - 1, lo, hi);
+        H[hi * n + hi - 2] = 0.;
+    }
+}
+
+/*
+ * This function computes all the eigenvalues of an upper Hessenberg matrix with the
+ * shifted QR algorithm (Francis double shift), after balancing the matrix.
+ * The active block is the trailing unreduced block of the matrix, i.e. the rows and columns
+ * from the last negligible subdiagonal entry to the last row not yet deflated. The shifts are the
+ * eigenvalues of its trailing 2 x 2 block, and when its last one or two eigenvalues have
+ * converged they are deflated. Every ten steps without deflation an exceptional shift breaks
+ * the cycles that the standard shifts may fall into.
+ *
+ * Parameters:
+ * - H: the matrix, stored by rows
+ * - n: its size
+ *
+ * Return:
+ * wr and wi are filled with the real and imaginary parts of the eigenvalues
+ */
+void hessenbergEigenvalues(std::vector<double> H, unsigned int n,
+                           std::vector<double> &wr, std::vector<double> &wi)
+{
+    auto h = [&H, n](unsigned int i, unsigned int j) -> double &
+    { return H[i * n + j]; };
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+    constexpr unsigned int maxSteps = 60u;
+
+    wr.assign(n, 0.);
+    wi.assign(n, 0.);
+    balance(H, n);
+
+    double norm = 0.;
+    for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = i > 0 ? i - 1 : 0; j < n; ++j)
+            norm += std::abs(h(i, j));
+
+    // rows and columns from 0 to end - 1 are not deflated yet
+    unsigned int end = n;
+    unsigned int steps = 0u;
+    while (end > 0)
+    {
+        const unsigned int hi = end - 1;
+        // the subdiagonal entries are negligible when they are below the rounding errors of the
+        // diagonal entries next to them
+        unsigned int lo = hi;
+        while (lo > 0)
+        {
+            double diagonal = std::abs(h(lo - 1, lo - 1)) + std::abs(h(lo, lo));
+            if (std::abs(h(lo, lo - 1)) <= eps * (diagonal != 0. ? diagonal : norm))
+            {
+                h(lo, lo - 1) = 0.;
+                break;
+            }
+            --lo;
+        }
+
+        if (lo == hi)
+        {
+            // a real eigenvalue
+            wr[hi] = h(hi, hi);
+            end -= 1;
+            steps = 0u;
+        }
+        else if (lo + 1 == hi)
+        {
+            // the eigenvalues of the 2 x 2 block [a b; c d] are (a + d) / 2 +- sqrt(p^2 + bc),
+            // with p = (a - d) / 2
+            double a = h(lo, lo), b = h(lo, hi), c = h(hi, lo), d = h(hi, hi);
+            double p = 0.5 * (a - d);
+            double discriminant = p * p + b * c;
+            if (discriminant >= 0.)
+            {
+                // p + root is computed without cancellation, and the other eigenvalue from
+                // (p + root)(p - root) = -bc
+                double root = std::copysign(std::sqrt(discriminant), p);
+                wr[lo] = d + p + root;
+                wr[hi] = p + root != 0. ? d - b * c / (p + root) : d + p;
+            }
+            else
+            {
+                wr[lo] = wr[hi] = d + p;
+                wi[lo] = std::sqrt(-discriminant);
+                wi[hi] = -wi[lo];
+            }
+            end -= 2;
+            steps = 0u;
+        }
+        else
+        {
+            if (steps == maxSteps)
+                throw std::overflow_error("The maximum number of iterations has been reached without convergence!");
+            ++steps;
+            double s, t;
+            if (steps % 10 == 0)
+            {
+                // exceptional double shift w, w, with w of the size of the last subdiagonal entries
+                double w = h(hi, hi) + 0.75 * (std::abs(h(hi, hi - 1)) + std::abs(h(hi - 1, hi - 2)));
+                s = 2. * w;
+                t = w * w;
+            }
+            else
+            {
+                // sum and product of the eigenvalues of the trailing 2 x 2 block
+                s = h(hi - 1, hi - 1) + h(hi, hi);
+                t = h(hi - 1, hi - 1) * h(hi, hi) - h(hi - 1, hi) * h(hi, hi - 1);
+            }
+            francisStep(H, n, lo, hi, s, t);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef __CHEBYSHEV_PROXY__
+#define __CHEBYSHEV_PROXY__
+
+#include "SolverBase.hpp"
+#include <array>
+#include <vector>
+
+/* Finds all the roots of a smooth function in an interval with a minimal number of evaluations.
+ * f is sampled at Chebyshev points, doubling their number (and reusing the previous samples)
+ * until the Chebyshev coefficients of the interpolant decay below tol. The roots of the
+ * interpolant are the real eigenvalues of its colleague matrix, and each one is polished
+ * with a single Newton step, using df if provided or the derivative of the interpolant
+ * otherwise. The total number of evaluations is the number of samples plus one per root.
+ */
+class ChebyshevProxy : public SolverBase
+{
+private:
+    T::FunctionType df_;
+    T::VariableType a_;
+    T::VariableType b_;
+    unsigned int maxDegree_;
+    unsigned int evaluations_{0u};
+    std::vector<double> coefficients_;
+
+    void interpolate();
+    double derivative(double t) const;
+
+public:
+    // constructors
+    ChebyshevProxy() = default;
+    ChebyshevProxy(const T::FunctionType &f,
+                   std::array<T::VariableType, 2> interval,
+                   double tol = 1e-4,
+                   unsigned int maxDegree = 512)
+        : SolverBase(f, tol), a_(interval[0]), b_(interval[1]), maxDegree_(maxDegree) {}
+    ChebyshevProxy(const T::FunctionType &f,
+                   const T::FunctionType &df,
+                   std::array<T::VariableType, 2> interval,
+                   double tol = 1e-4,
+                   unsigned int maxDegree = 512)
+        : SolverBase(f, tol), df_(df), a_(interval[0]), b_(interval[1]), maxDegree_(maxDegree) {}
+
+    // setters
+    void setDerivative(T::FunctionType df) { df_ = df; };
+    void setA(T::VariableType a) { a_ = a; };
+    void setB(T::VariableType b) { b_ = b; };
+    void setMaxDegree(unsigned int maxDegree) { maxDegree_ = maxDegree; };
+
+    // getters
+    // Number of evaluations of f performed by the last call to solveAll()
+    unsigned int getEvaluations() const { return evaluations_; };
+    // Chebyshev coefficients of the interpolant built by the last call to solveAll()
+    const std::vector<double> &getCoefficients() const { return coefficients_; };
+
+    // methods
+    // Returns all the roots of f in [a, b], sorted
+    std::vector<T::VariableType> solveAll();
+    // Returns the smallest root of f in [a, b]
+    T::VariableType solve() override;
+};
+
+// Eigenvalues (real and imaginary parts) of an upper Hessenberg matrix stored by rows
+void hessenbergEigenvalues(std::vector<double> H, unsigned int n,
+                           std::vector<double> &wr, std::vector<double> &wi);
+
+#endif // __CHEBYSHEV_PROXY__
@@ -0,0 +1,78 @@
+#include "Checkpoint.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr std::uint64_t magic = 0x54504b4843ull; // "CHKPT"
+
+    struct Header
+    {
+        std::uint64_t magic;
+        std::uint64_t size;
+        std::uint64_t signature;
+    };
+}
+
+/* FNV-1a hash of the characters of the tag and the bytes of the values, -0 and 0 are the same
+ * value. The signature does not identify the function, which can not be serialized.
+ */
+std::uint64_t checkpointSignature(const std::string &tag, std::initializer_list<double> values)
+{
+    std::uint64_t h = 1469598103934665603ull;
+    for (unsigned char character : tag)
+        h = (h ^ character) * 1099511628211ull;
+    for (double value : values)
+    {
+        value += 0.;
+        unsigned char bytes[sizeof(double)];
+        std::memcpy(bytes, &value, sizeof(double));
+        for (unsigned char byte : bytes)
+            h = (h ^ byte) * 1099511628211ull;
+    }
+    return h;
+}
+
+void writeCheckpoint(const std::string &path, const void *data, std::size_t size, std::uint64_t signature)
+{
+    std::string temporary = path + ".tmp";
+    int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        throw std::runtime_error("It was not possible to write the checkpoint " + path);
+    Header header{magic, size, signature};
+    bool written = write(fd, &header, sizeof(header)) == sizeof(header) &&
+                   write(fd, data, size) == static_cast<ssize_t>(size) &&
+                   fsync(fd) == 0;
+    close(fd);
+    // rename is atomic, the checkpoint is either the previous one or the new one
+    if (!written || rename(temporary.c_str(), path.c_str()) != 0)
+        throw std::runtime_error("It was not possible to write the checkpoint " + path);
+}
+
+bool readCheckpoint(const std::string &path, void *data, std::size_t size, std::uint64_t signature)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        if (errno == ENOENT)
+            return false;
+        throw std::runtime_error("It was not possible to read the checkpoint " + path);
+    }
+    Header header;
+    bool valid = read(fd, &header, sizeof(header)) == sizeof(header) &&
+                 header.magic == magic && header.size == size;
+    if (valid && header.signature != signature)
+    {
+        close(fd);
+        throw std::invalid_argument("The checkpoint " + path + " belongs to a different problem!");
+    }
+    valid = valid && read(fd, data, size) == static_cast<ssize_t>(size);
+    close(fd);
+    if (!valid)
+        throw std::runtime_error("The file " + path + " is not a valid checkpoint");
+    return true;
+}
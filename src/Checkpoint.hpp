@@ -0,0 +1,39 @@
+#ifndef __CHECKPOINT__
+#define __CHECKPOINT__
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+/* Compact checkpoints of the state of a computation, i.e. a trivially copyable structure
+ * stored as it is in memory, together with the signature of the problem it belongs to.
+ * A checkpoint is written to a temporary file that replaces the previous checkpoint only
+ * once it is complete and on disk, so a crash at any time leaves a valid checkpoint.
+ */
+
+// Signature of a problem, computed from a tag of the kind of computation and the values that
+// identify it
+std::uint64_t checkpointSignature(const std::string &tag, std::initializer_list<double> values);
+
+void writeCheckpoint(const std::string &path, const void *data, std::size_t size, std::uint64_t signature);
+
+bool readCheckpoint(const std::string &path, void *data, std::size_t size, std::uint64_t signature);
+
+// Saves the state in the file
+template <class State>
+void saveCheckpoint(const std::string &path, const State &state, std::uint64_t signature)
+{
+    static_assert(std::is_trivially_copyable_v<State>, "Only trivially copyable states can be saved");
+    writeCheckpoint(path, &state, sizeof(State), signature);
+}
+
+// Loads the state from the file, false if there is no checkpoint
+template <class State>
+bool loadCheckpoint(const std::string &path, State &state, std::uint64_t signature)
+{
+    static_assert(std::is_trivially_copyable_v<State>, "Only trivially copyable states can be loaded");
+    return readCheckpoint(path, &state, sizeof(State), signature);
+}
+
+#endif // __CHECKPOINT__
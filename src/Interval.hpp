@@ -0,0 +1,146 @@
+#ifndef __INTERVAL__
+#define __INTERVAL__
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+
+/* Closed interval [lo, hi] of real numbers.
+ * Every operation rounds the computed bounds outward by one ulp, so that the result
+ * is guaranteed to contain the exact range of the operation over the operands
+ * (assuming the elementary functions are accurate to within one ulp).
+ */
+class Interval
+{
+private:
+    double lo_;
+    double hi_;
+
+    static double down(double x) { return std::nextafter(x, -std::numeric_limits<double>::infinity()); };
+    static double up(double x) { return std::nextafter(x, std::numeric_limits<double>::infinity()); };
+
+public:
+    // constructors
+    Interval() : lo_(0.), hi_(0.) {}
+    Interval(double x) : lo_(x), hi_(x) {}
+    Interval(double lo, double hi) : lo_(lo), hi_(hi)
+    {
+        if (!(lo <= hi))
+            throw std::invalid_argument("The lower bound of an interval must not exceed the upper bound!");
+    }
+
+    // Rigorous enclosure of pi
+    static Interval pi() { return Interval(down(M_PI), up(M_PI)); };
+
+    // getters
+    double lower() const { return lo_; };
+    double upper() const { return hi_; };
+    double mid() const { return lo_ + 0.5 * (hi_ - lo_); };
+    double width() const { return hi_ - lo_; };
+
+    // methods
+    bool contains(double x) const { return lo_ <= x && x <= hi_; };
+    // True if the interval lies in the interior of other
+    bool isInteriorOf(const Interval &other) const { return other.lo_ < lo_ && hi_ < other.hi_; };
+
+    // arithmetic
+    friend Interval operator-(const Interval &x) { return Interval(-x.hi_, -x.lo_); };
+    friend Interval operator+(const Interval &x, const Interval &y)
+    {
+        return Interval(down(x.lo_ + y.lo_), up(x.hi_ + y.hi_));
+    };
+    friend Interval operator-(const Interval &x, const Interval &y)
+    {
+        return Interval(down(x.lo_ - y.hi_), up(x.hi_ - y.lo_));
+    };
+    friend Interval operator*(const Interval &x, const Interval &y)
+    {
+        double p1 = x.lo_ * y.lo_, p2 = x.lo_ * y.hi_, p3 = x.hi_ * y.lo_, p4 = x.hi_ * y.hi_;
+        return Interval(down(std::min({p1, p2, p3, p4})), up(std::max({p1, p2, p3, p4})));
+    };
+    friend Interval operator/(const Interval &x, const Interval &y)
+    {
+        if (y.contains(0.))
+            throw std::domain_error("Interval division by an interval containing zero!");
+        double q1 = x.lo_ / y.lo_, q2 = x.lo_ / y.hi_, q3 = x.hi_ / y.lo_, q4 = x.hi_ / y.hi_;
+        return Interval(down(std::min({q1, q2, q3, q4})), up(std::max({q1, q2, q3, q4})));
+    };
+
+    friend std::ostream &operator<<(std::ostream &os, const Interval &x)
+    {
+        return os << "[" << x.lo_ << ", " << x.hi_ << "]";
+    };
+};
+
+// Intersection of two intervals, empty if they are disjoint
+inline std::optional<Interval> intersect(const Interval &x, const Interval &y)
+{
+    double lo = std::max(x.lower(), y.lower());
+    double hi = std::min(x.upper(), y.upper());
+    if (lo > hi)
+        return std::nullopt;
+    return Interval(lo, hi);
+}
+
+// Smallest interval containing both x and y
+inline Interval hull(const Interval &x, const Interval &y)
+{
+    return Interval(std::min(x.lower(), y.lower()), std::max(x.upper(), y.upper()));
+}
+
+// Square, tighter than x * x because it does not suffer from the dependency problem
+inline Interval sqr(const Interval &x)
+{
+    double l = x.lower() * x.lower(), u = x.upper() * x.upper();
+    double lo = x.contains(0.) ? 0. : std::min(l, u);
+    return Interval(std::max(0., std::nextafter(lo, 0.)),
+                    std::nextafter(std::max(l, u), std::numeric_limits<double>::infinity()));
+}
+
+// Integer power
+inline Interval pow(const Interval &x, unsigned int n)
+{
+    if (n == 0)
+        return Interval(1.);
+    if (n % 2 == 0)
+        return pow(sqr(x), n / 2);
+    // odd powers are monotone, the bounds are computed on the point intervals of the ends
+    Interval lo{x.lower()}, hi{x.upper()};
+    Interval rlo{lo}, rhi{hi};
+    for (unsigned int i = 1; i < n; ++i)
+    {
+        rlo = rlo * lo;
+        rhi = rhi * hi;
+    }
+    return Interval(rlo.lower(), rhi.upper());
+}
+
+// Exponential, monotone increasing
+inline Interval exp(const Interval &x)
+{
+    return Interval(std::max(0., std::nextafter(std::exp(x.lower()), 0.)),
+                    std::nextafter(std::exp(x.upper()), std::numeric_limits<double>::infinity()));
+}
+
+// Natural logarithm, monotone increasing
+inline Interval log(const Interval &x)
+{
+    if (x.lower() <= 0.)
+        throw std::domain_error("Interval logarithm of an interval containing non-positive values!");
+    return Interval(std::nextafter(std::log(x.lower()), -std::numeric_limits<double>::infinity()),
+                    std::nextafter(std::log(x.upper()), std::numeric_limits<double>::infinity()));
+}
+
+// Square root, monotone increasing
+inline Interval sqrt(const Interval &x)
+{
+    if (x.lower() < 0.)
+        throw std::domain_error("Interval square root of an interval containing negative values!");
+    return Interval(std::max(0., std::nextafter(std::sqrt(x.lower()), 0.)),
+                    std::nextafter(std::sqrt(x.upper()), std::numeric_limits<double>::infinity()));
+}
+
+#endif // __INTERVAL__
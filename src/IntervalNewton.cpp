@@ -0,0 +1,216 @@
+#include "IntervalNewton.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+IntervalNewton::IntervalNewton(const IntervalFunctionType &F,
+                               const IntervalFunctionType &dF,
+                               std::array<T::VariableType, 2> interval,
+                               double tol,
+                               unsigned int threads)
+    : SolverBase(T::FunctionType([F](const T::VariableType &x)
+                                 { return F(Interval(x)).mid(); }),
+                 tol),
+      F_(F), dF_(dF), domain_(interval[0], interval[1]), threads_(threads)
+{
+}
+
+// Subintervals waiting to be explored, shared by the threads of solveAll
+struct IntervalNewton::WorkQueue
+{
+    std::vector<Interval> pending;
+    std::vector<RootEnclosure> roots;
+    // threads waiting for a subinterval, read without the lock by search
+    std::atomic<unsigned int> idle{0};
+    // threads exploring a subinterval
+    unsigned int busy{0};
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+// Iterates the interval Newton operator on an interval already known to contain a unique root
+RootEnclosure IntervalNewton::contract(Interval X) const
+{
+    while (X.width() > tol_)
+    {
+        double m = X.mid();
+        auto Y = intersect(m - F_(Interval(m)) / dF_(X), X);
+        // the root is in X, so the intersection can not be empty
+        if (!Y || Y->width() >= X.width())
+            break;
+        X = *Y;
+    }
+    return {X, true};
+}
+
+std::vector<RootEnclosure> IntervalNewton::search(Interval X, WorkQueue &work) const
+{
+    while (true)
+    {
+        // No root in X
+        if (!F_(X).contains(0.))
+            return {};
+
+        double m = X.mid();
+        // X is too small, or can not be split any further in floating point
+        if (X.width() <= tol_ || !(X.lower() < m && m < X.upper()))
+            return {{X, false}};
+
+        Interval D = dF_(X);
+        if (D.contains(0.))
+            break;
+
+        Interval N = m - F_(Interval(m)) / D;
+        auto Y = intersect(N, X);
+        if (!Y)
+            return {};
+        if (N.isInteriorOf(X))
+            return {contract(*Y)};
+        // Bisect if the Newton operator did not contract enough
+        if (Y->width() > 0.5 * X.width())
+        {
+            X = *Y;
+            break;
+        }
+        X = *Y;
+    }
+
+    double m = X.mid();
+    Interval left(X.lower(), m);
+    Interval right(m, X.upper());
+
+    // The right half goes to an idle thread, if there is one
+    if (work.idle.load(std::memory_order_relaxed) > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(work.mutex);
+            work.pending.push_back(right);
+        }
+        work.condition.notify_one();
+        return search(left, work);
+    }
+
+    auto roots = search(left, work);
+    auto rightRoots = search(right, work);
+    roots.insert(roots.end(), rightRoots.begin(), rightRoots.end());
+    return roots;
+}
+
+// Explores the subintervals in the queue until it is empty and no other thread can fill it again
+void IntervalNewton::explore(WorkQueue &work) const
+{
+    std::unique_lock<std::mutex> lock(work.mutex);
+    while (true)
+    {
+        ++work.idle;
+        work.condition.wait(lock, [&work]()
+                            { return !work.pending.empty() || work.busy == 0 || work.error; });
+        --work.idle;
+        if (work.pending.empty() || work.error)
+            break;
+
+        Interval X = work.pending.back();
+        work.pending.pop_back();
+        ++work.busy;
+        lock.unlock();
+
+        std::vector<RootEnclosure> roots;
+        std::exception_ptr error;
+        try
+        {
+            roots = search(X, work);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        --work.busy;
+        work.roots.insert(work.roots.end(), roots.begin(), roots.end());
+        if (error && !work.error)
+            work.error = error;
+        if (work.busy == 0 || work.error)
+            work.condition.notify_all();
+    }
+}
+
+/* Overlapping enclosures (e.g. a root lying on the boundary of two subintervals, or the
+ * small subintervals around a multiple root) are merged, and the uniqueness of the root
+ * in the merged enclosure is checked again with the interval Newton operator.
+ */
+std::vector<RootEnclosure> IntervalNewton::solveAll() const
+{
+    WorkQueue work;
+    work.pending.push_back(domain_);
+    unsigned int threads = threads_ > 0 ? threads_ : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> pool;
+    for (unsigned int i = 1; i < threads; ++i)
+        pool.emplace_back(&IntervalNewton::explore, this, std::ref(work));
+    explore(work);
+    for (auto &thread : pool)
+        thread.join();
+    if (work.error)
+        std::rethrow_exception(work.error);
+
+    auto &roots = work.roots;
+    std::sort(roots.begin(), roots.end(), [](const RootEnclosure &r1, const RootEnclosure &r2)
+              { return r1.enclosure.lower() < r2.enclosure.lower(); });
+
+    std::vector<RootEnclosure> merged;
+    for (const auto &root : roots)
+    {
+        if (!merged.empty() && merged.back().enclosure.upper() >= root.enclosure.lower())
+        {
+            merged.back().enclosure = hull(merged.back().enclosure, root.enclosure);
+            merged.back().unique = false;
+        }
+        else
+            merged.push_back(root);
+    }
+
+    for (std::size_t i = 0; i < merged.size(); ++i)
+    {
+        auto &root = merged[i];
+        if (root.unique)
+            continue;
+        // epsilon-inflation, the root may lie on the boundary of the enclosure. X stays in the
+        // domain and it does not reach the neighbouring enclosures, so that the enclosures
+        // stay disjoint and no root is verified twice
+        double delta = 0.5 * std::max(root.enclosure.width(), tol_);
+        double lower = std::max(root.enclosure.lower() - delta, domain_.lower());
+        double upper = std::min(root.enclosure.upper() + delta, domain_.upper());
+        if (i > 0)
+            lower = std::max(lower, merged[i - 1].enclosure.upper());
+        if (i + 1 < merged.size())
+            upper = std::min(upper, merged[i + 1].enclosure.lower());
+        Interval X(lower, upper);
+        Interval D = dF_(X);
+        if (D.contains(0.))
+            continue;
+        double m = X.mid();
+        Interval N = m - F_(Interval(m)) / D;
+        if (N.isInteriorOf(X))
+            root = contract(N);
+    }
+    return merged;
+}
+
+SolverTraits::VariableType IntervalNewton::solve()
+{
+    auto roots = solveAll();
+    if (roots.empty())
+        throw std::invalid_argument("The function has no zero in the provided interval!");
+
+    auto it = std::find_if(roots.begin(), roots.end(), [](const RootEnclosure &r)
+                           { return r.unique; });
+    const Interval &X = it != roots.end() ? it->enclosure : roots.front().enclosure;
+    report_ = {X.mid(), std::numeric_limits<T::ReturnType>::quiet_NaN(), 0u};
+    return report_.root;
+}
@@ -0,0 +1,66 @@
+#ifndef __INTERVAL_NEWTON__
+#define __INTERVAL_NEWTON__
+
+#include "SolverBase.hpp"
+#include "Interval.hpp"
+#include <array>
+#include <vector>
+
+// Enclosure of a root of f, unique is true if the enclosure is proven to contain exactly one root
+struct RootEnclosure
+{
+    Interval enclosure;
+    bool unique;
+};
+
+/* Certified search of all the roots of f in an interval.
+ * The domain is recursively subdivided and every subinterval is either discarded,
+ * when the interval extension of f proves that it contains no root, or contracted
+ * with the interval Newton operator N(X) = m - F(m) / F'(X). When N(X) lies in the
+ * interior of X the root in X exists and is unique.
+ * Since subintervals are discarded only when they provably contain no root, every
+ * root of f in the domain is contained in one of the returned enclosures.
+ * The subdivision tree is explored by a fixed pool of threads that share a queue of
+ * subintervals: a thread hands half of its subinterval over to the queue only while
+ * another thread is idle, and explores it by itself otherwise.
+ */
+class IntervalNewton : public SolverBase
+{
+public:
+    using IntervalFunctionType = std::function<Interval(const Interval &)>;
+
+private:
+    IntervalFunctionType F_;
+    IntervalFunctionType dF_;
+    Interval domain_;
+    unsigned int threads_{0};
+
+    struct WorkQueue;
+
+    std::vector<RootEnclosure> search(Interval X, WorkQueue &work) const;
+    void explore(WorkQueue &work) const;
+    RootEnclosure contract(Interval X) const;
+
+public:
+    // constructors
+    IntervalNewton() = default;
+    // F and dF are called concurrently by several threads, so they must be thread-safe
+    IntervalNewton(const IntervalFunctionType &F,
+                   const IntervalFunctionType &dF,
+                   std::array<T::VariableType, 2> interval,
+                   double tol = 1e-4,
+                   unsigned int threads = 0);
+
+    // setters
+    void setDomain(std::array<T::VariableType, 2> interval) { domain_ = Interval(interval[0], interval[1]); };
+    // Number of threads, all the available cores if 0
+    void setThreads(unsigned int threads) { threads_ = threads; };
+
+    // methods
+    // Returns the enclosures of all the roots in the domain, sorted
+    std::vector<RootEnclosure> solveAll() const;
+    // Returns the midpoint of the first enclosure, preferring the ones with a unique root
+    T::VariableType solve() override;
+};
+
+#endif // __INTERVAL_NEWTON__
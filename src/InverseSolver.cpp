@@ -0,0 +1,176 @@
+#include "InverseSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // Interpolates x(y) and its derivative in the segments of the targets
+    void interpolate(std::size_t n, const std::size_t *__restrict segment, const double *__restrict ys,
+                     const double *__restrict y, const double *__restrict c0, const double *__restrict c1,
+                     const double *__restrict c2, const double *__restrict c3,
+                     double *__restrict xs, double *__restrict dxdy)
+    {
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::size_t i = segment[k];
+            double s = ys[k] - y[i];
+            xs[k] = c0[i] + s * (c1[i] + s * (c2[i] + s * c3[i]));
+            dxdy[k] = c1[i] + s * (2 * c2[i] + s * 3 * c3[i]);
+        }
+    }
+
+    // Newton step kept inside the segment, the offset is NaN for the targets out of range
+    void polish(std::size_t n, const std::size_t *__restrict segment, const double *__restrict x,
+                const double *__restrict resid, const double *__restrict dxdy, const double *__restrict offset,
+                double *__restrict xs)
+    {
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::size_t i = segment[k];
+            double xi = x[i], xj = x[i + 1];
+            double lo = xi < xj ? xi : xj;
+            double hi = xi < xj ? xj : xi;
+            double polished = xs[k] - resid[k] * dxdy[k];
+            polished = polished > lo ? polished : lo;
+            polished = polished < hi ? polished : hi;
+            xs[k] = polished + offset[k];
+        }
+    }
+}
+
+InverseSolver::InverseSolver(const T::FunctionType &f,
+                             std::array<T::VariableType, 2> interval,
+                             unsigned int samples) : f_(f)
+{
+    if (samples < 2)
+        throw std::invalid_argument("At least two samples are needed to build the inverse function!");
+
+    const unsigned int n = samples;
+    const double h = (interval[1] - interval[0]) / (n - 1);
+    x_.resize(n);
+    y_.resize(n);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        x_[i] = interval[0] + i * h;
+        y_[i] = f_(x_[i]);
+    }
+
+    if (y_.back() < y_.front())
+    {
+        std::reverse(x_.begin(), x_.end());
+        std::reverse(y_.begin(), y_.end());
+    }
+    for (unsigned int i = 0; i + 1 < n; ++i)
+        if (!(y_[i] < y_[i + 1]))
+            throw std::invalid_argument("The function must be strictly monotone in the provided interval!");
+
+    // Monotone tangents of x(y) (Fritsch-Carlson, as in PCHIP)
+    std::vector<double> dy(n - 1), d(n - 1), m(n);
+    for (unsigned int i = 0; i + 1 < n; ++i)
+    {
+        dy[i] = y_[i + 1] - y_[i];
+        d[i] = (x_[i + 1] - x_[i]) / dy[i];
+    }
+    m[0] = d[0];
+    m[n - 1] = d[n - 2];
+    for (unsigned int i = 1; i + 1 < n; ++i)
+    {
+        double w1 = 2 * dy[i] + dy[i - 1];
+        double w2 = dy[i] + 2 * dy[i - 1];
+        m[i] = (w1 + w2) / (w1 / d[i - 1] + w2 / d[i]);
+    }
+
+    c0_.resize(n - 1);
+    c1_.resize(n - 1);
+    c2_.resize(n - 1);
+    c3_.resize(n - 1);
+    for (unsigned int i = 0; i + 1 < n; ++i)
+    {
+        c0_[i] = x_[i];
+        c1_[i] = m[i];
+        c2_[i] = (3 * d[i] - 2 * m[i] - m[i + 1]) / dy[i];
+        c3_[i] = (m[i] + m[i + 1] - 2 * d[i]) / (dy[i] * dy[i]);
+    }
+
+    // Buckets uniform in y, as many as the segments
+    buckets_.resize(n);
+    bucketScale_ = (n - 1) / (y_.back() - y_.front());
+    unsigned int segment = 0;
+    for (unsigned int k = 0; k < n; ++k)
+    {
+        double yk = y_.front() + k / bucketScale_;
+        while (segment + 2 < n && y_[segment + 1] <= yk)
+            ++segment;
+        buckets_[k] = segment;
+    }
+}
+
+/* Index of the segment [y_i, y_i+1] containing y, assumed to be in range.
+ * The segment is between the first segments of the bucket of y and of the next one, and it is
+ * found by a binary search among them, so a bucket crowded by a steep part of f costs a
+ * logarithmic number of comparisons. The range is extended by one segment, in case rounding
+ * puts y in the bucket before the right one.
+ */
+unsigned int InverseSolver::locate(T::ReturnType y) const
+{
+    const std::size_t last = y_.size() - 2;
+    auto bucket = std::min<std::size_t>(static_cast<std::size_t>((y - y_.front()) * bucketScale_), buckets_.size() - 1);
+    std::size_t first = buckets_[bucket];
+    std::size_t end = std::min<std::size_t>(bucket + 1 < buckets_.size() ? buckets_[bucket + 1] + 1 : last, last);
+    // first segment i >= first with y <= y_i+1, last if there is none
+    return std::lower_bound(y_.begin() + first + 1, y_.begin() + end + 1, y) - y_.begin() - 1;
+}
+
+SolverTraits::VariableType InverseSolver::solve(T::ReturnType y) const
+{
+    if (!(y_.front() <= y && y <= y_.back()))
+        throw std::out_of_range("The target value is out of the range of the function!");
+
+    unsigned int i = locate(y);
+    double s = y - y_[i];
+    T::VariableType x = c0_[i] + s * (c1_[i] + s * (c2_[i] + s * c3_[i]));
+    double dxdy = c1_[i] + s * (2 * c2_[i] + s * 3 * c3_[i]);
+
+    // Newton step on f(x) - y, kept inside the segment that brackets the root
+    x -= (f_(x) - y) * dxdy;
+    return std::clamp(x, std::min(x_[i], x_[i + 1]), std::max(x_[i], x_[i + 1]));
+}
+
+/* The batch is processed in separate passes over contiguous arrays (lookup, interpolation,
+ * evaluation of f, polishing). The lookup branches, while the interpolation and the polishing
+ * are branch free and they are vectorized by the compiler, with gathers of the data of the
+ * segments (emulated without AVX2). The gathers need restrict pointers, the compiler can not
+ * check at run time that the stores to the batch do not overlap them.
+ */
+std::vector<SolverTraits::VariableType> InverseSolver::solve(const std::vector<T::ReturnType> &ys) const
+{
+    const std::size_t n = ys.size();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<std::size_t> segment(n);
+    // 0 for the targets in range, NaN for the others
+    std::vector<double> offset(n);
+    std::vector<T::VariableType> xs(n);
+    std::vector<double> dxdy(n);
+    std::vector<T::ReturnType> resid(n);
+
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        bool inRange = y_.front() <= ys[k] && ys[k] <= y_.back();
+        segment[k] = inRange ? locate(ys[k]) : 0u;
+        offset[k] = inRange ? 0. : nan;
+    }
+
+    interpolate(n, segment.data(), ys.data(), y_.data(), c0_.data(), c1_.data(), c2_.data(), c3_.data(),
+                xs.data(), dxdy.data());
+
+    // f is not evaluated at the points extrapolated for the targets out of range, which may be
+    // outside its domain
+    for (std::size_t k = 0; k < n; ++k)
+        resid[k] = offset[k] == 0. ? f_(xs[k]) - ys[k] : 0.;
+
+    polish(n, segment.data(), x_.data(), resid.data(), dxdy.data(), offset.data(), xs.data());
+
+    return xs;
+}
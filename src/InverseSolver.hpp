@@ -0,0 +1,51 @@
+#ifndef __INVERSE_SOLVER__
+#define __INVERSE_SOLVER__
+
+#include "SolverTraits.hpp"
+#include <array>
+#include <vector>
+
+/* Solves f(x) = y for many right-hand sides y, with f monotone in [a, b].
+ * The setup samples f on a uniform grid and builds a monotone piecewise cubic Hermite
+ * interpolant of the inverse function x(y), together with a table of uniform buckets in y
+ * that locates the segment containing a given y, in constant time when the segments are spread
+ * evenly across the buckets and with a binary search in a crowded bucket.
+ * Each query evaluates the interpolant and polishes the result with one Newton step,
+ * safeguarded by the segment bracket, so it costs a single evaluation of f.
+ */
+class InverseSolver
+{
+public:
+    using T = SolverTraits;
+
+private:
+    T::FunctionType f_;
+    // Nodes of the inverse function, sorted by increasing y
+    std::vector<T::ReturnType> y_;
+    std::vector<T::VariableType> x_;
+    // Cubic coefficients of x(y) in each segment, in powers of (y - y_i)
+    std::vector<double> c0_, c1_, c2_, c3_;
+    // First segment that intersects each bucket
+    std::vector<unsigned int> buckets_;
+    double bucketScale_;
+
+    unsigned int locate(T::ReturnType y) const;
+
+public:
+    // constructors
+    InverseSolver(const T::FunctionType &f,
+                  std::array<T::VariableType, 2> interval,
+                  unsigned int samples = 1024);
+
+    // getters
+    // Range of values of f where the inverse is available
+    std::array<T::ReturnType, 2> getRange() const { return {y_.front(), y_.back()}; };
+
+    // methods
+    // Returns x such that f(x) = y
+    T::VariableType solve(T::ReturnType y) const;
+    // Batch version of solve, NaN is returned for the targets out of range
+    std::vector<T::VariableType> solve(const std::vector<T::ReturnType> &ys) const;
+};
+
+#endif // __INVERSE_SOLVER__
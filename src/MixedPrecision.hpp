@@ -0,0 +1,157 @@
+#ifndef __MIXED_PRECISION__
+#define __MIXED_PRECISION__
+
+#include "SolverCore.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/* Two-stage solve pipeline.
+ * Stage one (screening) brackets the root and bisects the bracket in single precision, with
+ * a float version of the function, as long as float can resolve the bracket.
+ * Stage two (refinement) checks the narrowed bracket with the double version of the function,
+ * widening it if rounding in float lost the root, and runs BrentSearch in double precision
+ * down to the requested tolerance.
+ * The functions are templates on the callable types: when the callables can be inlined and
+ * are branch free, the batch screening loop is vectorized by the compiler (e.g. 4 lanes of
+ * float with SSE for x^3 + x - p, check with -fopt-info-vec-optimized).
+ */
+namespace MixedPrecision
+{
+    // Smallest bracket width that is worth screening in float
+    inline double screeningWidth(double a, double b, double tol)
+    {
+        constexpr double epsf = std::numeric_limits<float>::epsilon();
+        return std::max(2 * tol, 64 * epsf * std::max(std::abs(a), std::abs(b)));
+    }
+
+    // Stage two: from the bracket [lo, hi] found in float to the root in double
+    template <class FD>
+    double refine(const FD &fd, double lo, double hi, std::array<double, 2> domain,
+                  double width, double tol, unsigned int maxIter)
+    {
+        double ylo = fd(lo);
+        double yhi = fd(hi);
+        double w = std::max(hi - lo, width);
+        while (ylo * yhi > 0)
+        {
+            if (lo <= domain[0] && hi >= domain[1])
+                throw std::invalid_argument("Function must change sign at the two end values!");
+            lo = std::max(domain[0], lo - w);
+            hi = std::min(domain[1], hi + w);
+            w *= 2;
+            ylo = fd(lo);
+            yhi = fd(hi);
+        }
+        if (ylo == 0)
+            return lo;
+        if (yhi == 0)
+            return hi;
+        return SolverCore::brent(fd, lo, hi, tol, maxIter);
+    }
+
+    // Solves f(x) = 0 in the interval, ff and fd are the float and double versions of f
+    template <class FF, class FD>
+    double solve(const FF &ff, const FD &fd, std::array<double, 2> interval,
+                 double tol = 1e-4, unsigned int maxIter = 150)
+    {
+        std::array<double, 2> domain{std::min(interval[0], interval[1]), std::max(interval[0], interval[1])};
+        const double width = screeningWidth(domain[0], domain[1], tol);
+
+        float lo = domain[0];
+        float hi = domain[1];
+        float ylo = ff(lo);
+        if (ylo * ff(hi) > 0)
+            throw std::invalid_argument("Function must change sign at the two end values!");
+
+        while (hi - lo > width)
+        {
+            float c = lo + 0.5f * (hi - lo);
+            float yc = ff(c);
+            if (yc == 0)
+            {
+                lo = hi = c;
+                break;
+            }
+            if (ylo * yc < 0)
+                hi = c;
+            else
+            {
+                lo = c;
+                ylo = yc;
+            }
+        }
+        return refine(fd, lo, hi, domain, width, tol, maxIter);
+    }
+
+    // Solves f(x) = 0 starting from a point, the bracket is searched in float
+    template <class FF, class FD>
+    double solve(const FF &ff, const FD &fd, double x1,
+                 double tol = 1e-4, unsigned int maxIter = 150)
+    {
+        auto [bracket, status] = SolverCore::bracketInterval(ff, static_cast<float>(x1), SolverCore::bracketStep,
+                                                           SolverCore::bracketMaxIter);
+        if (!status)
+            throw std::invalid_argument("It was not possible to find an interval that brackets the zero of f");
+        return solve(ff, fd, std::array<double, 2>{bracket.a, bracket.b}, tol, maxIter);
+    }
+
+    /* Solves f(x; p) = 0 in the interval for all the parameters p, ff(x, p) and fd(x, p) are
+     * the float and double versions of f. NaN is returned for the problems that can not be solved.
+     * The screening bisects all the brackets in lockstep, with the same number of steps, so all
+     * the brackets have the same width and only their lower ends lo are stored. The sign of f at
+     * lo never changes, and the step of lo is selected with a mask: a conditional expression
+     * would become a branch or a conditional store, which GCC does not vectorize.
+     */
+    template <class FF, class FD>
+    std::vector<double> solveBatch(const FF &ff, const FD &fd, const std::vector<double> &params,
+                                   std::array<double, 2> interval, double tol = 1e-4, unsigned int maxIter = 150)
+    {
+        std::array<double, 2> domain{std::min(interval[0], interval[1]), std::max(interval[0], interval[1])};
+        const double width = screeningWidth(domain[0], domain[1], tol);
+        const std::size_t n = params.size();
+
+        std::vector<float> p(params.begin(), params.end());
+        std::vector<float> lo(n, domain[0]);
+        std::vector<float> ylo(n);
+        for (std::size_t k = 0; k < n; ++k)
+            ylo[k] = ff(lo[k], p[k]);
+
+        // half width of the brackets, halved exactly at each step
+        float h = static_cast<float>(domain[1] - domain[0]);
+        const auto steps = static_cast<unsigned int>(std::max(0., std::ceil(std::log2((domain[1] - domain[0]) / width))));
+        for (unsigned int step = 0; step < steps; ++step)
+        {
+            h *= 0.5f;
+            const auto bits = std::bit_cast<std::uint32_t>(h);
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                float yc = ff(lo[k] + h, p[k]);
+                // lo moves to the midpoint if f has the same sign there
+                std::uint32_t right = -static_cast<std::uint32_t>(ylo[k] * yc > 0);
+                lo[k] += std::bit_cast<float>(bits & right);
+            }
+        }
+
+        std::vector<double> roots(n);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            auto f = [&fd, pk = params[k]](double x)
+            { return fd(x, pk); };
+            try
+            {
+                roots[k] = refine(f, lo[k], std::min(lo[k] + static_cast<double>(h), domain[1]), domain, width, tol, maxIter);
+            }
+            catch (const std::exception &)
+            {
+                roots[k] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+        return roots;
+    }
+}
+
+#endif // __MIXED_PRECISION__
@@ -0,0 +1,121 @@
+#ifndef __POLICY_SOLVER__
+#define __POLICY_SOLVER__
+
+#include "Checkpoint.hpp"
+#include "SolverBase.hpp"
+#include "SolverCore.hpp"
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+// Marks the values of f at the ends of the bracket as unknown
+inline void forgetValues(Bracket &bracket)
+{
+    bracket.fa = bracket.fb = std::numeric_limits<SolverTraits::ReturnType>::quiet_NaN();
+}
+
+/* Solver composed of a step, a safeguard and a termination policy (see the namespace Policies
+ * in SolverCore.hpp). The bracketing methods need an interval, Newton steps need the derivative
+ * of f and either one initial point or, with a bracketing safeguard, an interval.
+ * The values of f at the ends of the interval can be provided, otherwise they are computed by
+ * solve().
+ * If a checkpoint file is set, the state of the iteration is saved in it after each evaluation
+ * of f or df, and solve() resumes from it, so an interrupted solve loses no evaluation. The file
+ * is removed once the solve succeeds.
+ */
+template <class Step, class Safeguard, class Termination>
+class PolicySolver : public SolverBase
+{
+protected:
+    T::FunctionType df_;
+    // initial interval, a == b for the methods that start from one point
+    Bracket bracket_{0., 0., std::numeric_limits<T::ReturnType>::quiet_NaN(), std::numeric_limits<T::ReturnType>::quiet_NaN()};
+    double tola_{1e-10};
+    unsigned int maxIter_{150u};
+    std::string checkpoint_;
+
+public:
+    // constructors
+    PolicySolver() = default;
+    PolicySolver(const T::FunctionType &f,
+                 const Bracket &bracket,
+                 double tol = 1e-4,
+                 double tola = 1e-10,
+                 unsigned int maxIter = 150)
+        : SolverBase(f, tol), bracket_(bracket), tola_(tola), maxIter_(maxIter) {}
+    PolicySolver(const T::FunctionType &f,
+                 std::array<T::VariableType, 2> interval,
+                 double tol = 1e-4,
+                 double tola = 1e-10,
+                 unsigned int maxIter = 150)
+        : SolverBase(f, tol), tola_(tola), maxIter_(maxIter)
+    {
+        bracket_.a = interval[0];
+        bracket_.b = interval[1];
+    }
+    PolicySolver(const T::FunctionType &f,
+                 const T::FunctionType &df,
+                 T::VariableType x0,
+                 double tol = 1e-4,
+                 double tola = 1e-10,
+                 unsigned int maxIter = 150)
+        : PolicySolver(f, df, std::array<T::VariableType, 2>{x0, x0}, tol, tola, maxIter) {}
+    PolicySolver(const T::FunctionType &f,
+                 const T::FunctionType &df,
+                 std::array<T::VariableType, 2> interval,
+                 double tol = 1e-4,
+                 double tola = 1e-10,
+                 unsigned int maxIter = 150)
+        : PolicySolver(f, interval, tol, tola, maxIter) { df_ = df; }
+
+    // setters
+    // The values of f at the ends are computed again only if needed
+    void setFunction(const T::FunctionType &f) override { SolverBase::setFunction(f); forgetValues(bracket_); };
+    void setDerivative(const T::FunctionType &df) { df_ = df; };
+    void setAbsoluteTollerance(double tola) { tola_ = tola; };
+    void setMaxIter(unsigned int maxIter) { maxIter_ = maxIter; };
+    // only the value at the end that changed is forgotten
+    void setA(T::VariableType a) { bracket_.a = a; bracket_.fa = std::numeric_limits<T::ReturnType>::quiet_NaN(); };
+    void setB(T::VariableType b) { bracket_.b = b; bracket_.fb = std::numeric_limits<T::ReturnType>::quiet_NaN(); };
+    // File of the checkpoints, none if empty. A checkpoint of a different problem (policies,
+    // initial points, tolerances or maximum number of iterations) is rejected, while a different
+    // function can not be detected.
+    virtual void setCheckpoint(const std::string &path) { checkpoint_ = path; };
+
+    // methods
+    T::VariableType solve() override
+    {
+        if (Step::needsDerivative && !df_)
+            throw std::invalid_argument("The derivative of the function has not been provided!");
+        auto state = Policies::initialState(bracket_);
+        if (checkpoint_.empty())
+            return Policies::iterate<Step, Safeguard, Termination>(f_, df_, state, tol_, tola_, maxIter_, &report_);
+
+        // the states of different compositions have the same layout, the tag tells them apart
+        static const std::string tag = std::string(typeid(Step).name()) + typeid(Safeguard).name() +
+                                       typeid(Termination).name();
+        auto signature = checkpointSignature(tag, {bracket_.a, bracket_.b, tol_, tola_, double(maxIter_)});
+        loadCheckpoint(checkpoint_, state, signature);
+        auto save = [this, signature](const decltype(state) &s)
+        { saveCheckpoint(checkpoint_, s, signature); };
+        auto root = Policies::iterate<Step, Safeguard, Termination>(f_, df_, state, tol_, tola_, maxIter_, &report_, save);
+        std::remove(checkpoint_.c_str());
+        return root;
+    };
+};
+
+// The compositions of the solvers in Solvers.hpp, which are built on them
+using PolicyBisection = PolicySolver<Policies::BisectionStep, Policies::Bracketing, Policies::HalfWidth>;
+using PolicySecant = PolicySolver<Policies::ChordStep, Policies::NoSafeguard, Policies::Residual>;
+using PolicyRegulaFalsi = PolicySolver<Policies::FalsePositionStep, Policies::Bracketing, Policies::Residual>;
+using PolicyNewton = PolicySolver<Policies::NewtonStep, Policies::NoSafeguard, Policies::Residual>;
+using PolicyBrent = PolicySolver<Policies::InverseQuadraticStep, Policies::BrentSafeguard, Policies::BracketWidth>;
+// Newton safeguarded by bisection
+using SafeNewton = PolicySolver<Policies::NewtonStep, Policies::GuardedBracketing,
+                                Policies::AnyOf<Policies::Residual, Policies::Increment>>;
+
+#endif // __POLICY_SOLVER__
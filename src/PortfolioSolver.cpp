@@ -0,0 +1,102 @@
+#include "PortfolioSolver.hpp"
+#include "Solvers.hpp"
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+SolverTraits::ReturnType EvaluationCache::operator()(const T::VariableType &x)
+{
+    ++calls_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = values_.find(x);
+        if (it != values_.end())
+            return it->second;
+    }
+    // f is evaluated outside the lock, other threads are not blocked by expensive evaluations
+    T::ReturnType y = f_(x);
+    std::lock_guard<std::mutex> lock(mutex_);
+    values_.emplace(x, y);
+    return y;
+}
+
+namespace
+{
+    // Thrown in the solvers that lost the race
+    struct Cancelled : public std::exception
+    {
+        const char *what() const noexcept override { return "Solver cancelled, another solver has converged."; }
+    };
+}
+
+SolverTraits::VariableType PortfolioSolver::solve()
+{
+    EvaluationCache cache(f_);
+    std::atomic<bool> done{false};
+    std::mutex mutex;
+    winner_.clear();
+
+    T::FunctionType f{[&cache, &done](const T::VariableType &x)
+                      {
+                          if (done)
+                              throw Cancelled();
+                          return cache(x);
+                      }};
+    T::FunctionType df;
+    if (df_)
+        df = [this, &done](const T::VariableType &x)
+        {
+            if (done)
+                throw Cancelled();
+            return df_(x);
+        };
+
+    // Each entry builds and runs a solver in its own thread
+    auto run = [](auto &&solver)
+    {
+        solver.solve();
+        return solver.getReport();
+    };
+    std::vector<std::pair<std::string, std::function<SolveReport()>>> portfolio{
+        {"Secant", [&]()
+         { return run(Secant(f, interval_, tol_, tola_, maxIter_)); }},
+        // the bracket is checked quietly, the threads do not write to std::cout
+        {"BrentSearch", [&]()
+         { return run(BrentSearch(f, checkChangeOfSign(f, interval_[0], interval_[1], true), tol_, maxIter_)); }},
+        {"RegulaFalsi", [&]()
+         { return run(RegulaFalsi(f, checkChangeOfSign(f, interval_[0], interval_[1], true), tol_, tola_)); }},
+        {df ? "Newton" : "QuasiNewton", [&]()
+         { return df ? run(Newton(f, df, interval_[0], tol_, tola_, maxIter_))
+                     : run(QuasiNewton(f, interval_[0], tol_, tola_, maxIter_)); }}};
+
+    std::vector<std::thread> threads;
+    for (const auto &[name, solver] : portfolio)
+        threads.emplace_back([&, name = name, solve = solver]()
+                             {
+                                 try
+                                 {
+                                     SolveReport report = solve();
+                                     std::lock_guard<std::mutex> lock(mutex);
+                                     if (!done)
+                                     {
+                                         done = true;
+                                         report_ = report;
+                                         winner_ = name;
+                                     }
+                                 }
+                                 catch (const std::exception &)
+                                 {
+                                     // a failed or cancelled solver leaves the race
+                                 } });
+
+    for (auto &thread : threads)
+        thread.join();
+    evaluations_ = cache.getEvaluations();
+
+    if (!done)
+        throw std::runtime_error("None of the solvers of the portfolio converged!");
+
+    return report_.root;
+}
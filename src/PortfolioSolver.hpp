@@ -0,0 +1,92 @@
+#ifndef __PORTFOLIO_SOLVER__
+#define __PORTFOLIO_SOLVER__
+
+#include "SolverBase.hpp"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Thread safe memoization of the evaluations of a function
+class EvaluationCache
+{
+public:
+    using T = SolverTraits;
+
+private:
+    T::FunctionType f_;
+    std::unordered_map<T::VariableType, T::ReturnType> values_;
+    mutable std::mutex mutex_;
+    std::atomic<unsigned int> calls_{0u};
+
+public:
+    // constructors
+    explicit EvaluationCache(const T::FunctionType &f) : f_(f) {}
+
+    // getters
+    // Number of distinct points where f has been evaluated
+    std::size_t getEvaluations() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return values_.size();
+    };
+    // Number of requests, including the ones answered by the cache
+    unsigned int getCalls() const { return calls_; };
+
+    // methods
+    T::ReturnType operator()(const T::VariableType &x);
+};
+
+/* Runs several solvers concurrently on the same problem, one thread each, sharing a cache
+ * of the evaluations of f. The first solver that converges wins: the others are cancelled
+ * cooperatively, since their next evaluation of f throws.
+ * The portfolio is made of Secant, BrentSearch, RegulaFalsi and Newton, the latter
+ * replaced by QuasiNewton when the derivative is not provided.
+ * The solvers call f and df concurrently from their threads, so f and df must be thread safe.
+ * The values of f are memoized under a lock, but the evaluations themselves are not serialized.
+ */
+class PortfolioSolver : public SolverBase
+{
+private:
+    T::FunctionType df_;
+    std::array<T::VariableType, 2> interval_;
+    double tola_;
+    unsigned int maxIter_;
+    std::string winner_;
+    std::size_t evaluations_{0u};
+
+public:
+    // constructors
+    PortfolioSolver() = default;
+    PortfolioSolver(const T::FunctionType &f,
+                    std::array<T::VariableType, 2> interval,
+                    double tol = 1e-4,
+                    double tola = 1e-10,
+                    unsigned int maxIter = 150)
+        : SolverBase(f, tol), interval_(interval), tola_(tola), maxIter_(maxIter) {}
+    PortfolioSolver(const T::FunctionType &f,
+                    const T::FunctionType &df,
+                    std::array<T::VariableType, 2> interval,
+                    double tol = 1e-4,
+                    double tola = 1e-10,
+                    unsigned int maxIter = 150)
+        : SolverBase(f, tol), df_(df), interval_(interval), tola_(tola), maxIter_(maxIter) {}
+
+    // setters
+    void setDerivative(T::FunctionType df) { df_ = df; };
+    void setInterval(std::array<T::VariableType, 2> interval) { interval_ = interval; };
+    void setAbsoluteTollerance(double tola) { tola_ = tola; };
+    void setMaxIter(unsigned int maxIter) { maxIter_ = maxIter; };
+
+    // getters
+    // Name of the solver that won the last call to solve()
+    const std::string &getWinner() const { return winner_; };
+    // Number of distinct evaluations of f spent by all the solvers in the last call to solve()
+    std::size_t getEvaluations() const { return evaluations_; };
+
+    // methods
+    T::VariableType solve() override;
+};
+
+#endif // __PORTFOLIO_SOLVER__
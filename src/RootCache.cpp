@@ -0,0 +1,281 @@
+#include "RootCache.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr std::uint64_t magic = 0x454843544f4f52ull; // "ROOTCHE"
+    constexpr std::uint32_t version = 1u;
+
+    enum Kind : std::uint32_t
+    {
+        // a solved problem
+        Exact = 1,
+        // the representative of a cell of parameters
+        Cell = 2
+    };
+
+    // Exclusive lock on the file, released when the guard is destroyed
+    struct FileLock
+    {
+        int fd;
+        explicit FileLock(int fd) : fd(fd)
+        {
+            int result;
+            while ((result = flock(fd, LOCK_EX)) != 0 && errno == EINTR)
+                ;
+            if (result != 0)
+                throw std::runtime_error(std::string("It was not possible to lock the root cache: ") + std::strerror(errno));
+        }
+        ~FileLock() { flock(fd, LOCK_UN); }
+    };
+
+    // FNV-1a hash of the bytes of the key
+    std::uint64_t hash(std::uint32_t kind, std::uint32_t function, const std::array<double, 4> &key)
+    {
+        std::uint64_t h = 1469598103934665603ull;
+        auto mix = [&h](const void *data, std::size_t size)
+        {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            for (std::size_t i = 0; i < size; ++i)
+                h = (h ^ bytes[i]) * 1099511628211ull;
+        };
+        mix(&kind, sizeof(kind));
+        mix(&function, sizeof(function));
+        mix(key.data(), sizeof(key));
+        // 0 marks the empty slots
+        return h | 1u;
+    }
+
+    // Signature of a problem, -0 and 0 are the same value
+    std::array<double, 4> signature(double param, std::array<double, 2> interval, double tol)
+    {
+        return {param + 0., interval[0] + 0., interval[1] + 0., tol + 0.};
+    }
+}
+
+struct RootCache::Header
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t slotSize;
+    std::uint64_t capacity;
+    double quantum;
+    // number of problems, the representatives of the cells are not counted; updated atomically
+    std::uint64_t count;
+};
+
+struct RootCache::Slot
+{
+    // hash of the key, 0 if the slot is empty; written last and read first, atomically
+    std::uint64_t tag;
+    std::uint32_t kind;
+    std::uint32_t function;
+    std::array<double, 4> key;
+    double root;
+    double slope;
+    // parameter of the problem, differs from the key for the representatives of the cells
+    double param;
+    std::uint32_t iterations;
+    std::uint32_t padding;
+};
+
+RootCache::RootCache(const std::string &path, std::size_t capacity, double quantum)
+{
+    if (!(quantum > 0))
+        throw std::invalid_argument("The width of the cells must be positive!");
+    std::size_t slots = 1u;
+    while (slots < capacity)
+        slots <<= 1;
+
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0)
+        throw std::runtime_error("It was not possible to open the file " + path);
+    try
+    {
+        // the first process creates the table, the others wait for it
+        FileLock lock(fd_);
+        struct stat info;
+        if (fstat(fd_, &info) != 0)
+            throw std::runtime_error("It was not possible to read the size of the file " + path);
+        if (info.st_size == 0)
+        {
+            Header header{magic, version, sizeof(Slot), slots, quantum, 0u};
+            if (ftruncate(fd_, sizeof(Header) + slots * sizeof(Slot)) != 0 ||
+                pwrite(fd_, &header, sizeof(header), 0) != sizeof(header))
+                throw std::runtime_error("It was not possible to create the cache in the file " + path);
+        }
+        else
+        {
+            Header header;
+            if (pread(fd_, &header, sizeof(header), 0) != sizeof(header) || header.magic != magic ||
+                header.version != version || header.slotSize != sizeof(Slot) ||
+                header.capacity == 0 || (header.capacity & (header.capacity - 1)) != 0 ||
+                header.capacity > (static_cast<std::size_t>(info.st_size) - sizeof(Header)) / sizeof(Slot) ||
+                static_cast<std::size_t>(info.st_size) != sizeof(Header) + header.capacity * sizeof(Slot))
+                throw std::runtime_error("The file " + path + " is not a valid root cache");
+            slots = header.capacity;
+        }
+    }
+    catch (...)
+    {
+        // the lock has been released, the constructor leaves no open file
+        close(fd_);
+        throw;
+    }
+
+    bytes_ = sizeof(Header) + slots * sizeof(Slot);
+    map_ = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (map_ == MAP_FAILED)
+    {
+        close(fd_);
+        throw std::runtime_error("It was not possible to map the file " + path);
+    }
+    header_ = static_cast<Header *>(map_);
+    slots_ = reinterpret_cast<Slot *>(static_cast<char *>(map_) + sizeof(Header));
+}
+
+RootCache::~RootCache()
+{
+    munmap(map_, bytes_);
+    close(fd_);
+}
+
+std::size_t RootCache::getCapacity() const
+{
+    return header_->capacity;
+}
+
+double RootCache::getQuantum() const
+{
+    return header_->quantum;
+}
+
+std::size_t RootCache::size() const
+{
+    return std::atomic_ref<std::uint64_t>(header_->count).load(std::memory_order_relaxed);
+}
+
+double RootCache::cell(T::ScalarType param) const
+{
+    return std::floor(param / header_->quantum);
+}
+
+const RootCache::Slot *RootCache::lookup(std::uint32_t kind, std::uint32_t function,
+                                         const std::array<double, 4> &key) const
+{
+    std::uint64_t tag = hash(kind, function, key);
+    std::size_t mask = header_->capacity - 1;
+    for (std::size_t i = 0, index = tag & mask; i <= mask; ++i, index = (index + 1) & mask)
+    {
+        const Slot &slot = slots_[index];
+        // the fields of a published slot are visible after the acquire load of its tag
+        auto current = std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t &>(slot.tag)).load(std::memory_order_acquire);
+        if (current == 0)
+            return nullptr;
+        if (current == tag && slot.kind == kind && slot.function == function &&
+            std::memcmp(slot.key.data(), key.data(), sizeof(key)) == 0)
+            return &slot;
+    }
+    return nullptr;
+}
+
+// Must be called holding both the locks of the writers
+bool RootCache::store(std::uint32_t kind, std::uint32_t function, const std::array<double, 4> &key,
+                      const SolveReport &report, T::ScalarType param)
+{
+    std::uint64_t tag = hash(kind, function, key);
+    std::size_t mask = header_->capacity - 1;
+    for (std::size_t i = 0, index = tag & mask; i <= mask; ++i, index = (index + 1) & mask)
+    {
+        Slot &slot = slots_[index];
+        std::atomic_ref<std::uint64_t> current(slot.tag);
+        if (current.load(std::memory_order_acquire) != 0)
+        {
+            if (current.load(std::memory_order_relaxed) == tag && slot.kind == kind &&
+                slot.function == function && std::memcmp(slot.key.data(), key.data(), sizeof(key)) == 0)
+                return false;
+            continue;
+        }
+        slot.kind = kind;
+        slot.function = function;
+        slot.key = key;
+        slot.root = report.root;
+        slot.slope = report.slope;
+        slot.param = param;
+        slot.iterations = report.iterations;
+        slot.padding = 0u;
+        current.store(tag, std::memory_order_release);
+        if (kind == Exact)
+            std::atomic_ref<std::uint64_t>(header_->count).fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+std::optional<SolveReport> RootCache::find(std::uint32_t function, T::ScalarType param,
+                                           std::array<T::VariableType, 2> interval, double tol) const
+{
+    const Slot *slot = lookup(Exact, function, signature(param, interval, tol));
+    if (!slot)
+        return std::nullopt;
+    return SolveReport{slot->root, slot->slope, slot->iterations};
+}
+
+bool RootCache::insert(std::uint32_t function, T::ScalarType param,
+                       std::array<T::VariableType, 2> interval, double tol, const SolveReport &report)
+{
+    std::lock_guard<std::mutex> guard(writeMutex_);
+    FileLock lock(fd_);
+    bool stored = store(Exact, function, signature(param, interval, tol), report, param);
+    // the first problem of the cell represents it, if it has a usable slope
+    if (stored && std::isfinite(report.slope) && report.slope != 0)
+        store(Cell, function, {cell(param), 0., 0., 0.}, report, param);
+    return stored;
+}
+
+std::optional<Bracket> RootCache::nearby(std::uint32_t function, T::ScalarType param, const T::FunctionType &f) const
+{
+    const Slot *closest = nullptr;
+    double c = cell(param);
+    for (double neighbour : {c - 1, c, c + 1})
+    {
+        const Slot *slot = lookup(Cell, function, {neighbour, 0., 0., 0.});
+        if (slot && (!closest || std::abs(slot->param - param) < std::abs(closest->param - param)))
+            closest = slot;
+    }
+    if (!closest)
+        return std::nullopt;
+
+    T::VariableType x0 = closest->root;
+    T::ReturnType y0 = f(x0);
+    if (y0 == 0)
+        return Bracket{x0, x0, y0, y0};
+    // the Newton step estimates the distance of the root, the bracket is twice as wide
+    T::VariableType x1 = x0 - 2 * y0 / closest->slope;
+    T::ReturnType y1 = f(x1);
+    if (y0 * y1 > 0)
+        return std::nullopt;
+    return x0 < x1 ? Bracket{x0, x1, y0, y1} : Bracket{x1, x0, y1, y0};
+}
+
+SolveReport RootCache::solve(std::uint32_t function, T::ScalarType param,
+                             std::array<T::VariableType, 2> interval, double tol, const SolverBuilderType &build)
+{
+    if (auto report = find(function, param, interval, tol))
+        return *report;
+    auto solver = build();
+    solver->solve();
+    insert(function, param, interval, tol, solver->getReport());
+    return solver->getReport();
+}
@@ -0,0 +1,82 @@
+#ifndef __ROOT_CACHE__
+#define __ROOT_CACHE__
+
+#include "Solvers.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+/* Persistent cache of the reports of solved problems, shared by all the processes that open
+ * the same file. A problem is identified by its signature: the id of a registered function,
+ * the value of its parameter, the initial interval and the tolerance.
+ * The cache is an open addressing hash table in a memory-mapped file. Entries are written
+ * once and never modified, and an entry is published by storing its tag last, so readers
+ * need no lock. Writers are serialized by a lock on the file, so any number of processes can
+ * insert concurrently. A full table accepts no new entries.
+ * For the approximate lookups the parameters are divided in cells of width quantum, and the
+ * first problem solved in each cell is recorded as its representative.
+ */
+class RootCache
+{
+public:
+    using T = SolverTraits;
+    // Builds the solver of a problem, called only if the problem is not in the cache
+    using SolverBuilderType = std::function<std::unique_ptr<SolverBase>()>;
+
+private:
+    struct Header;
+    struct Slot;
+
+    int fd_{-1};
+    void *map_{nullptr};
+    std::size_t bytes_{0u};
+    Header *header_{nullptr};
+    Slot *slots_{nullptr};
+    // serializes the writers of this process, the lock on the file only the processes
+    std::mutex writeMutex_;
+
+    const Slot *lookup(std::uint32_t kind, std::uint32_t function, const std::array<double, 4> &key) const;
+    bool store(std::uint32_t kind, std::uint32_t function, const std::array<double, 4> &key,
+               const SolveReport &report, T::ScalarType param);
+    double cell(T::ScalarType param) const;
+
+public:
+    // constructors
+    // Opens the cache in the file, creating it with the given capacity and cell width if it
+    // does not exist. The capacity is rounded up to a power of two.
+    RootCache(const std::string &path, std::size_t capacity = 1u << 16, double quantum = 1e-2);
+    RootCache(const RootCache &) = delete;
+    RootCache &operator=(const RootCache &) = delete;
+
+    // getters
+    std::size_t getCapacity() const;
+    double getQuantum() const;
+    // Number of problems in the cache, the representatives of the cells are not counted
+    std::size_t size() const;
+
+    // methods
+    // Report of the problem, if it is in the cache
+    std::optional<SolveReport> find(std::uint32_t function, T::ScalarType param,
+                                    std::array<T::VariableType, 2> interval, double tol) const;
+    // Stores the report of the problem, false if it was already present or the cache is full
+    bool insert(std::uint32_t function, T::ScalarType param,
+                std::array<T::VariableType, 2> interval, double tol, const SolveReport &report);
+    /* Bracket of the root of f(x) = f(x; param) predicted from the closest problem of the same
+     * function in the neighbouring cells: a Newton step from its root, with its slope, gives
+     * the other end of the bracket. It costs two evaluations of f, and it is empty if there
+     * is no close problem or the prediction does not bracket the root. Its width is zero if the
+     * root of the closest problem is a root of f too.
+     */
+    std::optional<Bracket> nearby(std::uint32_t function, T::ScalarType param, const T::FunctionType &f) const;
+    // Report of the problem, from the cache if present, otherwise from the solver, which is then stored
+    SolveReport solve(std::uint32_t function, T::ScalarType param,
+                      std::array<T::VariableType, 2> interval, double tol, const SolverBuilderType &build);
+
+    // destructor
+    ~RootCache();
+};
+
+#endif // __ROOT_CACHE__
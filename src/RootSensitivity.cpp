@@ -0,0 +1,90 @@
+#include "RootSensitivity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+RootSensitivity::RootSensitivity(const ParametricFunctionType &f,
+                                 const SolverBuilderType &build,
+                                 T::ScalarType p0,
+                                 T::VariableType guess,
+                                 double tol,
+                                 unsigned int order)
+    : RootSensitivity(f, ParametricFunctionType(), build, p0, guess, tol, order) {}
+
+RootSensitivity::RootSensitivity(const ParametricFunctionType &f,
+                                 const ParametricFunctionType &dfdp,
+                                 const SolverBuilderType &build,
+                                 T::ScalarType p0,
+                                 T::VariableType guess,
+                                 double tol,
+                                 unsigned int order)
+    : f_(f), dfdp_(dfdp), build_(build), tol_(tol), order_(order)
+{
+    if (order_ < 1 || order_ > 2)
+        throw std::invalid_argument("Only first and second order predictions are available!");
+    solveAt(p0, guess);
+}
+
+// Solves the problem at p and computes the derivatives of the root at p
+void RootSensitivity::solveAt(const T::ScalarType &p, const T::VariableType &guess)
+{
+    auto solver = build_(p, guess);
+    if (!solver)
+        throw std::invalid_argument("The solver could not be built!");
+    solver->solve();
+    ++solves_;
+    p0_ = p;
+    report_ = solver->getReport();
+
+    const T::VariableType x = report_.root;
+    // steps of the centered differences, optimal for first and second derivatives
+    const double hx = std::cbrt(std::numeric_limits<double>::epsilon()) * std::max(1., std::abs(x));
+    const double hp = std::cbrt(std::numeric_limits<double>::epsilon()) * std::max(1., std::abs(p));
+
+    double fx = report_.slope;
+    if (!std::isfinite(fx) || fx == 0)
+        fx = (f_(x + hx, p) - f_(x - hx, p)) / (2 * hx);
+    if (fx == 0)
+        throw std::overflow_error("Division by zero detected, the root is not simple.");
+    report_.slope = fx;
+
+    double fp = dfdp_ ? dfdp_(x, p) : (f_(x, p + hp) - f_(x, p - hp)) / (2 * hp);
+    dxdp_ = -fp / fx;
+
+    d2xdp2_ = 0.;
+    if (order_ == 2)
+    {
+        // d2x/dp2 = -(f_xx x'^2 + 2 f_xp x' + f_pp) / f_x
+        const double kx = std::sqrt(std::sqrt(std::numeric_limits<double>::epsilon())) * std::max(1., std::abs(x));
+        const double kp = std::sqrt(std::sqrt(std::numeric_limits<double>::epsilon())) * std::max(1., std::abs(p));
+        const double f0 = f_(x, p);
+        const double fxx = (f_(x + kx, p) - 2 * f0 + f_(x - kx, p)) / (kx * kx);
+        const double fpp = (f_(x, p + kp) - 2 * f0 + f_(x, p - kp)) / (kp * kp);
+        const double fxp = (f_(x + kx, p + kp) - f_(x + kx, p - kp) -
+                            f_(x - kx, p + kp) + f_(x - kx, p - kp)) /
+                           (4 * kx * kp);
+        d2xdp2_ = -(fxx * dxdp_ * dxdp_ + 2 * fxp * dxdp_ + fpp) / fx;
+    }
+}
+
+SolverTraits::VariableType RootSensitivity::predict(T::ScalarType p) const
+{
+    const double dp = p - p0_;
+    return report_.root + dxdp_ * dp + 0.5 * d2xdp2_ * dp * dp;
+}
+
+double RootSensitivity::errorEstimate(T::ScalarType p, T::VariableType x) const
+{
+    return std::abs(f_(x, p) / report_.slope);
+}
+
+SolverTraits::VariableType RootSensitivity::solve(T::ScalarType p)
+{
+    T::VariableType x = predict(p);
+    if (errorEstimate(p, x) <= tol_)
+        return x;
+    solveAt(p, x);
+    return report_.root;
+}
@@ -0,0 +1,75 @@
+#ifndef __ROOT_SENSITIVITY__
+#define __ROOT_SENSITIVITY__
+
+#include "SolverBase.hpp"
+#include <memory>
+
+/* Sensitivity of the root x(p) of a parametric function f(x; p) with respect to p.
+ * After a solve at p0 the implicit function theorem gives
+ *   dx/dp = -(df/dp) / (df/dx),
+ * where df/dx is the slope reported by the solver (the derivative used by Newton, or the
+ * last secant slope of Secant and BrentSearch). The roots at nearby parameters are then
+ * predicted with a first or second order Taylor expansion, without iterating.
+ * The error of a prediction is estimated with one evaluation of f, as |f(x; p)| / |df/dx|,
+ * and the problem is solved again, centering the expansion at the new parameter, only when
+ * the estimate exceeds the tolerance.
+ */
+class RootSensitivity
+{
+public:
+    using T = SolverTraits;
+    using ParametricFunctionType = std::function<T::ReturnType(const T::VariableType &, const T::ScalarType &)>;
+    // Builds the solver of f(x; p) = 0 given the parameter and a guess of the root
+    using SolverBuilderType = std::function<std::unique_ptr<SolverBase>(const T::ScalarType &, const T::VariableType &)>;
+
+private:
+    ParametricFunctionType f_;
+    ParametricFunctionType dfdp_;
+    SolverBuilderType build_;
+    double tol_;
+    unsigned int order_;
+    T::ScalarType p0_;
+    SolveReport report_;
+    double dxdp_;
+    double d2xdp2_;
+    unsigned int solves_{0u};
+
+    void solveAt(const T::ScalarType &p, const T::VariableType &guess);
+
+public:
+    // constructors
+    // The problem is solved at p0 with guess as initial guess. If df/dp is not provided
+    // it is approximated with centered finite differences.
+    RootSensitivity(const ParametricFunctionType &f,
+                    const SolverBuilderType &build,
+                    T::ScalarType p0,
+                    T::VariableType guess,
+                    double tol = 1e-4,
+                    unsigned int order = 1);
+    RootSensitivity(const ParametricFunctionType &f,
+                    const ParametricFunctionType &dfdp,
+                    const SolverBuilderType &build,
+                    T::ScalarType p0,
+                    T::VariableType guess,
+                    double tol = 1e-4,
+                    unsigned int order = 1);
+
+    // getters
+    T::ScalarType getParameter() const { return p0_; };
+    const SolveReport &getReport() const { return report_; };
+    double getDerivative() const { return dxdp_; };
+    double getSecondDerivative() const { return d2xdp2_; };
+    // Number of full solves performed so far
+    unsigned int getSolves() const { return solves_; };
+
+    // methods
+    // Predicts the root at p without iterating
+    T::VariableType predict(T::ScalarType p) const;
+    // Estimates the error of x as a root at p
+    double errorEstimate(T::ScalarType p, T::VariableType x) const;
+    // Returns the prediction at p if its error estimate is within the tolerance,
+    // otherwise solves the problem at p and centers the expansion there
+    T::VariableType solve(T::ScalarType p);
+};
+
+#endif // __ROOT_SENSITIVITY__
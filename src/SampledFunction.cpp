@@ -0,0 +1,170 @@
+#include "SampledFunction.hpp"
+#include "SolverCore.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SampledFunction::SampledFunction(const std::string &path,
+                                 T::VariableType x0,
+                                 T::VariableType dx,
+                                 Interpolation interpolation)
+    : x0_(x0), dx_(dx), interpolation_(interpolation)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("It was not possible to open the file " + path);
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("It was not possible to read the size of the file " + path);
+    }
+    std::size_t bytes = info.st_size;
+    if (bytes < 2 * sizeof(double))
+    {
+        close(fd);
+        throw std::invalid_argument("At least two samples are needed!");
+    }
+    void *map = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the file is closed
+    close(fd);
+    if (map == MAP_FAILED)
+        throw std::runtime_error("It was not possible to map the file " + path);
+    // the samples are mostly streamed from the beginning to the end
+    madvise(map, bytes, MADV_SEQUENTIAL);
+
+    storage_ = std::shared_ptr<const void>(map, [bytes](const void *p)
+                                           { munmap(const_cast<void *>(p), bytes); });
+    data_ = static_cast<const double *>(map);
+    size_ = bytes / sizeof(double);
+    check();
+}
+
+SampledFunction::SampledFunction(std::vector<double> samples,
+                                 T::VariableType x0,
+                                 T::VariableType dx,
+                                 Interpolation interpolation)
+    : x0_(x0), dx_(dx), interpolation_(interpolation)
+{
+    auto vector = std::make_shared<const std::vector<double>>(std::move(samples));
+    data_ = vector->data();
+    size_ = vector->size();
+    storage_ = vector;
+    check();
+}
+
+void SampledFunction::check() const
+{
+    if (size_ < 2)
+        throw std::invalid_argument("At least two samples are needed!");
+    if (!(dx_ > 0))
+        throw std::invalid_argument("The step between the samples must be positive!");
+}
+
+SolverTraits::ReturnType SampledFunction::operator()(const T::VariableType &x) const
+{
+    double t = (x - x0_) / dx_;
+    if (!(t >= 0 && t <= size_ - 1))
+        throw std::out_of_range("The point is outside the sampled interval!");
+    auto i = std::min(static_cast<std::size_t>(t), size_ - 2);
+    return segment(i, t - i);
+}
+
+// Refines the crossing in the segment [x_i, x_i+1]
+SolverTraits::VariableType ZeroCrossingScanner::refine(std::size_t i) const
+{
+    const double *v = data_.data();
+    if (v[i] == 0)
+        return data_.getStart() + i * data_.getStep();
+    if (v[i + 1] == 0)
+        return data_.getStart() + (i + 1) * data_.getStep();
+
+    double t;
+    if (data_.getInterpolation() == Interpolation::Linear)
+        t = v[i] / (v[i] - v[i + 1]);
+    else
+    {
+        // the lambda is inlined in the Brent iteration
+        auto p = [this, i](double t)
+        { return data_.segment(i, t); };
+        t = SolverCore::brent(p, SolverCore::BasicBracket<double>{0., 1., v[i], v[i + 1]},
+                              tol_ / data_.getStep(), 100u);
+    }
+    return data_.getStart() + (i + t) * data_.getStep();
+}
+
+// Finds the crossings in the segments [x_i, x_i+1] with begin <= i < end
+std::vector<SolverTraits::VariableType> ZeroCrossingScanner::scan(std::size_t begin, std::size_t end) const
+{
+    constexpr std::size_t block = 2048;
+    const double *v = data_.data();
+    std::vector<T::VariableType> roots;
+
+    for (std::size_t b = begin; b < end; b += block)
+    {
+        std::size_t e = std::min(b + block, end);
+        // branch-free, vectorized by the compiler: the signs are kept as doubles,
+        // the conversions from bool would prevent the vectorization
+        double changes{0.};
+        for (std::size_t i = b; i < e; ++i)
+        {
+            double s0 = v[i] < 0 ? 1. : 0.;
+            double s1 = v[i + 1] < 0 ? 1. : 0.;
+            changes += s0 != s1 ? 1. : 0.;
+        }
+        if (changes == 0)
+            continue;
+
+        for (std::size_t i = b; i < e; ++i)
+        {
+            if ((v[i] < 0) == (v[i + 1] < 0))
+                continue;
+            // zero samples count as positive: a zero between two negative samples is not
+            // a crossing, and it is seen by both its segments
+            if (v[i] == 0 && (i == 0 || v[i - 1] < 0))
+                continue;
+            if (v[i + 1] == 0 && (i + 2 == data_.size() || v[i + 2] < 0))
+                continue;
+            roots.push_back(refine(i));
+        }
+    }
+    return roots;
+}
+
+std::vector<SolverTraits::VariableType> ZeroCrossingScanner::solveAll() const
+{
+    std::size_t segments = data_.size() - 1;
+    unsigned int threads = threads_ > 0 ? threads_ : std::max(1u, std::thread::hardware_concurrency());
+    // chunks of at least one million segments, the smaller ones are not worth a thread
+    constexpr std::size_t minChunk = 1u << 20;
+    std::size_t chunk = std::max(minChunk, (segments + threads - 1) / threads);
+
+    std::vector<std::future<std::vector<T::VariableType>>> tasks;
+    for (std::size_t begin = chunk; begin < segments; begin += chunk)
+        tasks.push_back(std::async(std::launch::async, &ZeroCrossingScanner::scan, this,
+                                   begin, std::min(begin + chunk, segments)));
+    auto roots = scan(0, std::min(chunk, segments));
+    for (auto &task : tasks)
+    {
+        auto chunkRoots = task.get();
+        roots.insert(roots.end(), chunkRoots.begin(), chunkRoots.end());
+    }
+    return roots;
+}
+
+SolverTraits::VariableType ZeroCrossingScanner::solve()
+{
+    auto roots = solveAll();
+    if (roots.empty())
+        throw std::invalid_argument("The sampled function has no zero crossing!");
+    report_ = {roots.front(), std::numeric_limits<T::ReturnType>::quiet_NaN(), 0u};
+    return report_.root;
+}
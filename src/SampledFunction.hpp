@@ -0,0 +1,114 @@
+#ifndef __SAMPLED_FUNCTION__
+#define __SAMPLED_FUNCTION__
+
+#include "SolverBase.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class Interpolation
+{
+    Linear,
+    Cubic
+};
+
+/* Function known only through its samples v_i = f(x0 + i*dx) on a uniform grid.
+ * The samples can be a binary file of doubles (in native byte order), which is memory-mapped
+ * and read on demand by the operating system, so the size of the data is not limited by the
+ * available memory, or a vector already in memory.
+ * Between two samples f is interpolated linearly or with a cubic Hermite interpolant whose
+ * slopes are the centered differences of the samples (Catmull-Rom spline, C1).
+ * Copies share the samples, so a SampledFunction can be used as a FunctionType.
+ */
+class SampledFunction
+{
+public:
+    using T = SolverTraits;
+
+private:
+    // Owns the samples: the mapping of the file, or the vector
+    std::shared_ptr<const void> storage_;
+    const double *data_{nullptr};
+    std::size_t size_{0u};
+    T::VariableType x0_;
+    T::VariableType dx_;
+    Interpolation interpolation_;
+
+    void check() const;
+
+public:
+    // constructors
+    SampledFunction(const std::string &path,
+                    T::VariableType x0,
+                    T::VariableType dx,
+                    Interpolation interpolation = Interpolation::Linear);
+    SampledFunction(std::vector<double> samples,
+                    T::VariableType x0,
+                    T::VariableType dx,
+                    Interpolation interpolation = Interpolation::Linear);
+
+    // setters
+    void setInterpolation(Interpolation interpolation) { interpolation_ = interpolation; };
+
+    // getters
+    const double *data() const { return data_; };
+    std::size_t size() const { return size_; };
+    T::VariableType getStart() const { return x0_; };
+    T::VariableType getStep() const { return dx_; };
+    Interpolation getInterpolation() const { return interpolation_; };
+
+    // methods
+    // Value of the interpolant in the segment [x_i, x_i+1], at the local coordinate t in [0, 1]
+    T::ReturnType segment(std::size_t i, double t) const
+    {
+        double v0 = data_[i], v1 = data_[i + 1];
+        if (interpolation_ == Interpolation::Linear)
+            return v0 + t * (v1 - v0);
+        // slopes in the local coordinate, one-sided at the ends of the data
+        double m0 = i > 0 ? 0.5 * (v1 - data_[i - 1]) : v1 - v0;
+        double m1 = i + 2 < size_ ? 0.5 * (data_[i + 2] - v0) : v1 - v0;
+        double t2 = t * t, t3 = t2 * t;
+        return (2 * t3 - 3 * t2 + 1) * v0 + (t3 - 2 * t2 + t) * m0 +
+               (-2 * t3 + 3 * t2) * v1 + (t3 - t2) * m1;
+    };
+    // Value of the interpolant at x, that must lie in the sampled interval
+    T::ReturnType operator()(const T::VariableType &x) const;
+};
+
+/* Finds all the zero crossings of a sampled function, i.e. the roots where it changes sign.
+ * The samples are streamed in blocks: each block is first tested for sign changes with a
+ * branch-free loop that the compiler vectorizes, and only the blocks containing a crossing
+ * are scanned again to locate them. Each crossing is refined on the interpolant: the linear
+ * one is solved exactly, the cubic one with the Brent search of SolverCore, starting from
+ * the samples at the ends of the segment, which are already known.
+ * The data is split in chunks scanned in parallel.
+ * A sample exactly equal to zero is a crossing only if the samples around it have opposite sign.
+ */
+class ZeroCrossingScanner : public SolverBase
+{
+private:
+    SampledFunction data_;
+    unsigned int threads_;
+
+    std::vector<T::VariableType> scan(std::size_t begin, std::size_t end) const;
+    T::VariableType refine(std::size_t i) const;
+
+public:
+    // constructors
+    ZeroCrossingScanner(const SampledFunction &data,
+                        double tol = 1e-10,
+                        unsigned int threads = 0)
+        : SolverBase(T::FunctionType(data), tol), data_(data), threads_(threads) {}
+
+    // setters
+    // Number of threads, all the available cores if 0
+    void setThreads(unsigned int threads) { threads_ = threads; };
+
+    // methods
+    // Returns all the zero crossings of the sampled function, sorted
+    std::vector<T::VariableType> solveAll() const;
+    // Returns the first zero crossing of the sampled function
+    T::VariableType solve() override;
+};
+
+#endif // __SAMPLED_FUNCTION__
@@ -2,6 +2,7 @@
 #define __SOLVER_BASE__
 
 #include "SolverTraits.hpp"
+#include <limits>
 
 class SolverBase
 {
@@ -12,6 +13,8 @@ public:
 protected:
     T::FunctionType f_;
     double tol_;
+    SolveReport report_{std::numeric_limits<T::VariableType>::quiet_NaN(),
+                        std::numeric_limits<T::ReturnType>::quiet_NaN(), 0u};
 
 public:
     // constructors
@@ -20,9 +23,13 @@ public:
                double tol = 1e-4) : f_(f), tol_(tol) {}
 
     // setters
-    void setFunction(const T::FunctionType &f) { f_ = f; };
+    virtual void setFunction(const T::FunctionType &f) { f_ = f; };
     void setTollerance(double tol) { tol_ = tol; };
 
+    // getters
+    // Report of the last call to solve()
+    const SolveReport &getReport() const { return report_; };
+
     // methods
     virtual T::VariableType solve() = 0;
 
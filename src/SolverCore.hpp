@@ -0,0 +1,640 @@
+#ifndef __SOLVER_CORE__
+#define __SOLVER_CORE__
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/* Core iterations of the solvers.
+ * There is a single iteration, Policies::iterate, and each method is a composition of a step,
+ * a safeguard and a termination policy. The functions in the namespace SolverCore run the
+ * compositions of the classic methods, and the solver classes in Solvers.hpp are PolicySolvers
+ * of the same compositions (see PolicySolver.hpp).
+ * They are function templates on the callable type, so they accept std::function as well as
+ * lambdas, and they are constexpr: with a constexpr-friendly callable (e.g. a lambda with a
+ * polynomial body) the root can be computed at compile time.
+ */
+namespace SolverCore
+{
+    // std::abs is constexpr only from C++23
+    template <class Real>
+    constexpr Real abs(Real x) { return x < 0 ? -x : x; }
+
+    /* Outcome of a solve: the root, the slope of f at the root (the derivative, or the slope of the
+     * last secant or chord, NaN if the solver did not compute any) and the number of iterations.
+     */
+    template <class Real, class Value = Real>
+    struct BasicReport
+    {
+        Real root;
+        Value slope;
+        unsigned int iterations;
+    };
+
+    // Interval [a, b] together with the values of the function at its ends, fa = f(a) and fb = f(b)
+    template <class Real, class Value = Real>
+    struct BasicBracket
+    {
+        Real a;
+        Real b;
+        Value fa;
+        Value fb;
+    };
+}
+
+/* Policies composing the iteration of a solver.
+ * A solver is the combination of
+ * - a step, which computes the next iterate from the state of the iteration,
+ * - a safeguard, which accepts or replaces the step and maintains the bracket, if any,
+ * - a termination test, which also tells which point of the state is the root.
+ * Policies are classes with static methods, always inlined, so the iteration generated for
+ * each combination has no calls and no run-time checks of the chosen policies, and its state
+ * is kept in registers.
+ */
+namespace Policies
+{
+    // NaN marks the unknown values in the state (std::isnan is not constexpr)
+    template <class Value>
+    constexpr bool unknown(Value v) { return v != v; }
+
+    // False for infinities and NaN (std::isfinite is not constexpr)
+    template <class Real>
+    constexpr bool finite(Real x) { return x - x == 0; }
+
+    // State of the iteration, seen by all the policies
+    template <class Real, class Value = Real>
+    struct State
+    {
+        // Current, previous and second previous iterates and the values of f at them
+        Real x, xOld, xOlder;
+        Value fx, fOld, fOlder;
+        // Derivatives of f at x and xOld, computed only for the steps that use them
+        Value dfx, dfOld;
+        // Scale of the residual, set by the safeguard; NaN until the safeguard is initialized
+        Value f0;
+        // Bracket of the root, maintained by the bracketing safeguards. For the others it is
+        // the initial interval, whose end b is the fixed end of the chords.
+        SolverCore::BasicBracket<Real, Value> bracket;
+        // Previous and second previous value of the end b of the bracket, and whether the
+        // last step was a bisection (Brent's method)
+        Real c, d;
+        Value fc;
+        bool bisected;
+        // Last two increments, for the guarded bracketing
+        Real stepOld, stepOlder;
+        unsigned int iter;
+    };
+
+    // steps
+
+    // Midpoint of the bracket
+    struct BisectionStep
+    {
+        static constexpr bool needsDerivative = false;
+        static constexpr bool needsBracket = true;
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto next(const S &s) { return (s.bracket.a + s.bracket.b) / 2; }
+    };
+
+    // Chord through the current iterate and the fixed end b of the initial interval
+    struct ChordStep
+    {
+        static constexpr bool needsDerivative = false;
+        static constexpr bool needsBracket = false;
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto next(const S &s)
+        {
+            const auto &k = s.bracket;
+            return s.x - s.fx * (k.b - s.x) / (k.fb - s.fx);
+        }
+    };
+
+    // Secant through the last two iterates, the first step is the chord through a and b
+    struct SecantStep
+    {
+        static constexpr bool needsDerivative = false;
+        static constexpr bool needsBracket = false;
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto next(const S &s)
+        {
+            if (s.x == s.xOld)
+                return ChordStep::next(s);
+            return s.x - s.fx * (s.x - s.xOld) / (s.fx - s.fOld);
+        }
+    };
+
+    // Secant through the ends of the bracket (regula falsi)
+    struct FalsePositionStep
+    {
+        static constexpr bool needsDerivative = false;
+        static constexpr bool needsBracket = true;
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto next(const S &s)
+        {
+            const auto &k = s.bracket;
+            double incra = -k.fa / (k.fb - k.fa);
+            double incrb = 1. - incra;
+            if (!(std::max(incra, incrb) <= 1.0 && std::min(incra, incrb) >= 0))
+                throw std::overflow_error("Chord is failing");
+            return k.a + incra * (k.b - k.a);
+        }
+    };
+
+    // Inverse quadratic interpolation of a, b and the previous b, secant through a and b
+    // if two of the values coincide
+    struct InverseQuadraticStep
+    {
+        static constexpr bool needsDerivative = false;
+        static constexpr bool needsBracket = true;
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto next(const S &s)
+        {
+            const auto &k = s.bracket;
+            if (k.fa != s.fc && k.fb != s.fc)
+            {
+                auto yab = k.fa - k.fb;
+                auto yac = k.fa - s.fc;
+                auto ycb = s.fc - k.fb;
+                return k.a * k.fa * s.fc / (yab * yac) + k.b * k.fa * s.fc / (yab * ycb) -
+                       s.c * k.fa * k.fb / (yac * ycb);
+            }
+            return k.b - k.fb * (k.b - k.a) / (k.fb - k.fa);
+        }
+    };
+
+    // Newton step, it needs the derivative of f
+    struct NewtonStep
+    {
+        static constexpr bool needsDerivative = true;
+        static constexpr bool needsBracket = false;
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto next(const S &s) { return s.x - s.fx / s.dfx; }
+    };
+
+    // safeguards
+
+    // Accepts every step, an exception is thrown if the step is not finite.
+    // The residual is scaled by the one at the initial iterate a.
+    struct NoSafeguard
+    {
+        static constexpr bool brackets = false;
+        template <class S>
+        [[gnu::always_inline]] static constexpr void init(S &s) { s.f0 = SolverCore::abs(s.fx); }
+        template <class S, class Real>
+        [[gnu::always_inline]] static constexpr Real filter(S &, Real c, double)
+        {
+            if (!finite(c))
+                throw std::overflow_error("Division by zero detected, method stopped.");
+            return c;
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr void update(S &) {}
+    };
+
+    /* Keeps a bracket of the root, the initial interval must bracket it.
+     * A step outside the bracket is replaced by bisection. The end b before the last update
+     * is kept in c. The residual is scaled by the largest one at the ends.
+     */
+    struct Bracketing
+    {
+        static constexpr bool brackets = true;
+        template <class S>
+        [[gnu::always_inline]] static constexpr void init(S &s)
+        {
+            const auto &k = s.bracket;
+            if (k.fa * k.fb > 0)
+                throw std::invalid_argument("Function must change sign at the two end values!");
+            s.f0 = std::max(SolverCore::abs(k.fa), SolverCore::abs(k.fb));
+            s.c = k.a;
+            s.fc = k.fa;
+        }
+        template <class S, class Real>
+        [[gnu::always_inline]] static constexpr Real filter(S &s, Real c, double)
+        {
+            const auto &k = s.bracket;
+            if (!(std::min(k.a, k.b) <= c && c <= std::max(k.a, k.b)))
+                return (k.a + k.b) / 2;
+            return c;
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr void update(S &s)
+        {
+            auto &k = s.bracket;
+            s.c = k.b;
+            s.fc = k.fb;
+            if (s.fx * k.fa < 0)
+            {
+                k.b = s.x;
+                k.fb = s.fx;
+            }
+            else
+            {
+                k.a = s.x;
+                k.fa = s.fx;
+            }
+        }
+    };
+
+    /* Bracketing that also replaces by bisection the steps that are not shorter than half
+     * the step before the last one, so that the convergence is never slower than bisection.
+     * The steps converging to the root from one side are not affected, since their length
+     * decreases even if the bracket does not. The iteration starts from the end with the
+     * smallest residual.
+     */
+    struct GuardedBracketing
+    {
+        static constexpr bool brackets = true;
+        template <class S>
+        [[gnu::always_inline]] static constexpr void init(S &s)
+        {
+            Bracketing::init(s);
+            const auto &k = s.bracket;
+            bool first = SolverCore::abs(k.fa) <= SolverCore::abs(k.fb);
+            s.x = s.xOld = s.xOlder = first ? k.a : k.b;
+            s.fx = s.fOld = s.fOlder = first ? k.fa : k.fb;
+            s.stepOld = s.stepOlder = std::numeric_limits<decltype(s.x)>::infinity();
+        }
+        template <class S, class Real>
+        [[gnu::always_inline]] static constexpr Real filter(S &s, Real c, double tol)
+        {
+            if (2 * SolverCore::abs(c - s.x) > SolverCore::abs(s.stepOlder))
+                return (s.bracket.a + s.bracket.b) / 2;
+            return Bracketing::filter(s, c, tol);
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr void update(S &s)
+        {
+            s.stepOlder = s.stepOld;
+            s.stepOld = s.x - s.xOld;
+            Bracketing::update(s);
+        }
+    };
+
+    /* Safeguard of Brent's method: a bracket whose end b has the smallest residual, and a
+     * step that is replaced by bisection unless it falls between (3a + b) / 4 and b and
+     * it is shorter than half the step before the last one.
+     */
+    struct BrentSafeguard
+    {
+        static constexpr bool brackets = true;
+        template <class S>
+        [[gnu::always_inline]] static constexpr void init(S &s)
+        {
+            auto &k = s.bracket;
+            if (SolverCore::abs(k.fa) < SolverCore::abs(k.fb))
+            {
+                std::swap(k.a, k.b);
+                std::swap(k.fa, k.fb);
+            }
+            Bracketing::init(s);
+            s.d = s.c;
+            s.bisected = true;
+            s.x = k.b;
+            s.fx = k.fb;
+        }
+        template <class S, class Real>
+        [[gnu::always_inline]] static constexpr Real filter(S &s, Real c, double tol)
+        {
+            using SolverCore::abs;
+            const auto &k = s.bracket;
+            if (((c - (3 * k.a + k.b) / 4) * (c - k.b) >= 0) ||
+                (s.bisected && abs(c - k.b) >= 0.5 * abs(k.b - s.c)) ||
+                (!s.bisected && abs(c - k.b) >= 0.5 * abs(s.c - s.d)) ||
+                (s.bisected && abs(k.b - s.c) < tol) ||
+                (!s.bisected && abs(s.c - s.d) < tol))
+            {
+                s.bisected = true;
+                return (k.a + k.b) / 2;
+            }
+            s.bisected = false;
+            return c;
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr void update(S &s)
+        {
+            auto &k = s.bracket;
+            s.d = s.c;
+            Bracketing::update(s);
+            if (SolverCore::abs(k.fa) < SolverCore::abs(k.fb))
+            {
+                std::swap(k.a, k.b);
+                std::swap(k.fa, k.fb);
+            }
+        }
+    };
+
+    // termination tests
+
+    // The residual is below tol times the scale of the residual plus tola
+    struct Residual
+    {
+        template <class S>
+        [[gnu::always_inline]] static constexpr bool stop(const S &s, double tol, double tola)
+        {
+            return SolverCore::abs(s.fx) <= tol * SolverCore::abs(s.f0) + tola;
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto root(const S &s) { return s.x; }
+    };
+
+    // The last increment is below tol, or the last iterate is a root
+    struct Increment
+    {
+        template <class S>
+        [[gnu::always_inline]] static constexpr bool stop(const S &s, double tol, double)
+        {
+            return s.fx == 0 || (s.iter > 0 && SolverCore::abs(s.x - s.xOld) <= tol);
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto root(const S &s) { return s.x; }
+    };
+
+    // The bracket is narrower than tol, or the last iterate is a root
+    struct BracketWidth
+    {
+        template <class S>
+        [[gnu::always_inline]] static constexpr bool stop(const S &s, double tol, double)
+        {
+            return s.fx == 0 || SolverCore::abs(s.bracket.b - s.bracket.a) <= tol;
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto root(const S &s) { return s.x; }
+    };
+
+    // Half the bracket is narrower than tol, the root is its midpoint
+    struct HalfWidth
+    {
+        template <class S>
+        [[gnu::always_inline]] static constexpr bool stop(const S &s, double tol, double)
+        {
+            return !(SolverCore::abs(s.bracket.b - s.bracket.a) > 2 * tol);
+        }
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto root(const S &s) { return (s.bracket.a + s.bracket.b) / 2; }
+    };
+
+    // A fixed number of iterations, the last iterate is returned without error
+    template <unsigned int N>
+    struct Budget
+    {
+        template <class S>
+        [[gnu::always_inline]] static constexpr bool stop(const S &s, double, double) { return s.iter >= N; }
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto root(const S &s) { return s.x; }
+    };
+
+    // Stops when any of the tests is satisfied, the root is the one of the first test
+    template <class... Tests>
+    struct AnyOf
+    {
+        template <class S>
+        [[gnu::always_inline]] static constexpr bool stop(const S &s, double tol, double tola) { return (Tests::stop(s, tol, tola) || ...); }
+        template <class S>
+        [[gnu::always_inline]] static constexpr auto root(const S &s) { return std::tuple_element_t<0, std::tuple<Tests...>>::root(s); }
+    };
+
+    // State before the first evaluation, from the initial interval (a == b for the methods
+    // that need only one point) and the values of f at its ends, NaN if unknown
+    template <class Real, class Value>
+    constexpr State<Real, Value> initialState(const SolverCore::BasicBracket<Real, Value> &bracket)
+    {
+        constexpr Value unknown = std::numeric_limits<Value>::quiet_NaN();
+        State<Real, Value> s{};
+        s.x = s.xOld = s.xOlder = s.c = s.d = bracket.a;
+        s.fx = s.fOld = s.fOlder = s.dfx = s.dfOld = s.f0 = s.fc = unknown;
+        s.bracket = bracket;
+        s.bisected = true;
+        s.stepOld = s.stepOlder = std::numeric_limits<Real>::infinity();
+        return s;
+    }
+
+    template <class Real, class Value>
+    constexpr State<Real, Value> initialState(Real a, Real b)
+    {
+        constexpr Value unknown = std::numeric_limits<Value>::quiet_NaN();
+        return initialState(SolverCore::BasicBracket<Real, Value>{a, b, unknown, unknown});
+    }
+
+    // Default checkpoint, does nothing
+    struct NoCheckpoint
+    {
+        template <class S>
+        constexpr void operator()(const S &) const {}
+    };
+
+    /* Iteration of the solver composed of the policies, from the state, which is updated when
+     * the iteration returns. The iteration starts from a, and from the interval [a, b] for
+     * the methods that use it.
+     * The state can be an initial state or the state saved by a previous iteration that was
+     * interrupted: the values of f and df in it, the unknown ones being NaN, are never computed
+     * again. checkpoint(s) is called after each evaluation of f or df.
+     * The maximum number of iterations is a safety limit: reaching it throws, unlike the
+     * Budget termination.
+     */
+    template <class Step, class Safeguard, class Termination, class F, class DF, class Real, class Value,
+              class Checkpoint = NoCheckpoint>
+    constexpr Real iterate(const F &f, const DF &df, State<Real, Value> &state, double tol, double tola,
+                           unsigned int maxIter, SolverCore::BasicReport<Real, Value> *report = nullptr,
+                           const Checkpoint &checkpoint = Checkpoint())
+    {
+        static_assert(!Step::needsBracket || Safeguard::brackets, "The step requires a bracketing safeguard");
+
+        // a local copy, which the compiler can keep in registers
+        State<Real, Value> s = state;
+        auto &k = s.bracket;
+        if (unknown(k.fa))
+        {
+            k.fa = f(k.a);
+            checkpoint(s);
+        }
+        if (unknown(k.fb))
+        {
+            k.fb = k.b == k.a ? k.fa : f(k.b);
+            checkpoint(s);
+        }
+        if (unknown(s.f0))
+        {
+            s.fx = s.fOld = s.fOlder = k.fa;
+            Safeguard::init(s);
+        }
+
+        while (!Termination::stop(s, tol, tola))
+        {
+            if (s.iter == maxIter)
+                throw std::overflow_error("The maximum number of iterations has been reached without convergence!");
+            if constexpr (Step::needsDerivative)
+            {
+                if (unknown(s.dfx))
+                {
+                    s.dfx = df(s.x);
+                    checkpoint(s);
+                }
+            }
+            Real c = Safeguard::filter(s, static_cast<Real>(Step::next(s)), tol);
+            Value fc = f(c);
+            s.xOlder = s.xOld;
+            s.fOlder = s.fOld;
+            s.xOld = s.x;
+            s.fOld = s.fx;
+            s.dfOld = s.dfx;
+            s.x = c;
+            s.fx = fc;
+            s.dfx = std::numeric_limits<Value>::quiet_NaN();
+            Safeguard::update(s);
+            // the iteration is counted when its evaluation is done
+            ++s.iter;
+            checkpoint(s);
+        }
+
+        if (report)
+        {
+            Value slope = std::numeric_limits<Value>::quiet_NaN();
+            if constexpr (Safeguard::brackets)
+                slope = (k.fb - k.fa) / (k.b - k.a);
+            else if constexpr (Step::needsDerivative)
+                slope = s.dfOld;
+            else if (s.x != s.xOld)
+                slope = (s.fx - s.fOld) / (s.x - s.xOld);
+            *report = {Termination::root(s), slope, s.iter};
+        }
+        state = s;
+        return Termination::root(s);
+    }
+
+    // Iteration of the solver composed of the policies, from the interval [a, b]
+    template <class Step, class Safeguard, class Termination, class F, class DF, class Real, class Value>
+    constexpr Real iterate(const F &f, const DF &df, const SolverCore::BasicBracket<Real, Value> &bracket,
+                           double tol, double tola, unsigned int maxIter,
+                           SolverCore::BasicReport<Real, Value> *report = nullptr)
+    {
+        auto s = initialState(bracket);
+        return iterate<Step, Safeguard, Termination>(f, df, s, tol, tola, maxIter, report);
+    }
+
+    // Evaluations of the derivative for the methods that do not use it
+    struct NoDerivative
+    {
+        template <class Real>
+        constexpr Real operator()(Real) const { return std::numeric_limits<Real>::quiet_NaN(); }
+    };
+}
+
+// The classic methods, run by the compositions of policies used by the solvers in Solvers.hpp
+namespace SolverCore
+{
+    // Chords through the fixed end b
+    template <class F, class Real>
+    constexpr Real secant(const F &f, Real a, Real b, double tol, double tola, unsigned int maxIter,
+                          BasicReport<Real, decltype(f(a))> *report = nullptr)
+    {
+        using namespace Policies;
+        constexpr auto unknown = std::numeric_limits<decltype(f(a))>::quiet_NaN();
+        return iterate<ChordStep, NoSafeguard, Residual>(f, NoDerivative(), BasicBracket<Real, decltype(f(a))>{a, b, unknown, unknown},
+                                                         tol, tola, maxIter, report);
+    }
+
+    template <class F, class Real, class Value>
+    constexpr Real bisection(const F &f, const BasicBracket<Real, Value> &bracket, double tol,
+                             BasicReport<Real, Value> *report = nullptr)
+    {
+        using namespace Policies;
+        return iterate<BisectionStep, Bracketing, HalfWidth>(f, NoDerivative(), bracket, tol, 0.,
+                                                             std::numeric_limits<unsigned int>::max(), report);
+    }
+
+    template <class F, class Real>
+    constexpr Real bisection(const F &f, Real a, Real b, double tol,
+                             BasicReport<Real, decltype(f(a))> *report = nullptr)
+    {
+        return bisection(f, BasicBracket<Real, decltype(f(a))>{a, b, f(a), f(b)}, tol, report);
+    }
+
+    template <class F, class DF, class Real>
+    constexpr Real newton(const F &f, const DF &df, Real x0, double tol, double tola, unsigned int maxIter,
+                          BasicReport<Real, decltype(f(x0))> *report = nullptr)
+    {
+        using namespace Policies;
+        constexpr auto unknown = std::numeric_limits<decltype(f(x0))>::quiet_NaN();
+        return iterate<NewtonStep, NoSafeguard, Residual>(f, df, BasicBracket<Real, decltype(f(x0))>{x0, x0, unknown, unknown},
+                                                          tol, tola, maxIter, report);
+    }
+
+    template <class F, class Real, class Value>
+    constexpr Real regulaFalsi(const F &f, const BasicBracket<Real, Value> &bracket, double tol, double tola,
+                               BasicReport<Real, Value> *report = nullptr)
+    {
+        using namespace Policies;
+        return iterate<FalsePositionStep, Bracketing, Residual>(f, NoDerivative(), bracket, tol, tola,
+                                                                std::numeric_limits<unsigned int>::max(), report);
+    }
+
+    template <class F, class Real>
+    constexpr Real regulaFalsi(const F &f, Real a, Real b, double tol, double tola,
+                               BasicReport<Real, decltype(f(a))> *report = nullptr)
+    {
+        return regulaFalsi(f, BasicBracket<Real, decltype(f(a))>{a, b, f(a), f(b)}, tol, tola, report);
+    }
+
+    template <class F, class Real, class Value>
+    constexpr Real brent(const F &f, const BasicBracket<Real, Value> &bracket, double tol, unsigned int maxIter,
+                         BasicReport<Real, Value> *report = nullptr)
+    {
+        using namespace Policies;
+        return iterate<InverseQuadraticStep, BrentSafeguard, BracketWidth>(f, NoDerivative(), bracket, tol, 0.,
+                                                                           maxIter, report);
+    }
+
+    template <class F, class Real>
+    constexpr Real brent(const F &f, Real a, Real b, double tol, unsigned int maxIter,
+                         BasicReport<Real, decltype(f(a))> *report = nullptr)
+    {
+        return brent(f, BasicBracket<Real, decltype(f(a))>{a, b, f(a), f(b)}, tol, maxIter, report);
+    }
+
+    // Default initial step and maximum number of steps of the search of a bracket
+    inline constexpr double bracketStep = 0.01;
+    inline constexpr unsigned int bracketMaxIter = 200u;
+
+    // Core of the function bracketInterval in Solvers.hpp, the bracket is searched in the precision of x1.
+    // y1 = f(x1) is known and it is not evaluated again.
+    template <class F, class Real, class Value>
+    constexpr std::tuple<BasicBracket<Real, Value>, bool>
+    bracketInterval(const F &f, Real x1, Value y1, double h, unsigned int maxIter)
+    {
+        constexpr Real expandFactor = 1.5;
+        Real step = abs(static_cast<Real>(h));
+        Real direction = 1;
+        Real x2 = x1 + step;
+        Value y2 = f(x2);
+        unsigned int iter = 0u;
+
+        // get initial decrement direction
+        while ((y1 * y2 > 0) && (iter < maxIter))
+        {
+            ++iter;
+            if (abs(y2) > abs(y1))
+            {
+                std::swap(y1, y2);
+                std::swap(x1, x2);
+                // change direction
+            }
+            direction = (x2 > x1) ? 1 : -1;
+            x1 = x2;
+            y1 = y2;
+            x2 += direction * step;
+            y2 = f(x2);
+            step *= expandFactor;
+        }
+        return std::make_tuple(BasicBracket<Real, Value>{x1, x2, y1, y2}, iter < maxIter);
+    }
+
+    template <class F, class Real>
+    constexpr auto bracketInterval(const F &f, Real x1, double h, unsigned int maxIter)
+    {
+        return bracketInterval(f, x1, f(x1), h, maxIter);
+    }
+}
+
+#endif // __SOLVER_CORE__
@@ -0,0 +1,413 @@
+#include "SolverDaemon.hpp"
+#include "SolverCore.hpp"
+#include "Solvers.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    // Reads exactly size bytes, returns false on end of file or error
+    bool readFull(int fd, void *buffer, std::size_t size)
+    {
+        auto *data = static_cast<char *>(buffer);
+        while (size > 0)
+        {
+            ssize_t n = ::recv(fd, data, size, 0);
+            if (n <= 0)
+                return false;
+            data += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    // Writes exactly size bytes, returns false on error. A closed peer does not raise SIGPIPE
+    bool writeFull(int fd, const void *buffer, std::size_t size)
+    {
+        const auto *data = static_cast<const char *>(buffer);
+        while (size > 0)
+        {
+            ssize_t n = ::send(fd, data, size, MSG_NOSIGNAL);
+            if (n <= 0)
+                return false;
+            data += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    sockaddr_un socketAddress(const std::string &path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path))
+            throw std::invalid_argument("The path of the socket is too long!");
+        std::strcpy(address.sun_path, path.c_str());
+        return address;
+    }
+
+    /* Removes the socket file left by a daemon that is no longer running. Nothing that is not a
+     * socket is removed, and a socket that accepts connections belongs to a running daemon.
+     */
+    void removeStaleSocket(const std::string &path, const sockaddr_un &address)
+    {
+        struct stat info;
+        if (lstat(path.c_str(), &info) != 0)
+        {
+            if (errno == ENOENT)
+                return;
+            throw std::runtime_error("It was not possible to check the path of the socket " + path);
+        }
+        if (!S_ISSOCK(info.st_mode))
+            throw std::runtime_error("The path " + path + " exists and it is not a socket");
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            throw std::runtime_error("It was not possible to create the socket");
+        int result = connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+        int error = errno;
+        close(fd);
+        if (result == 0)
+            throw std::runtime_error("The socket " + path + " is in use by a running daemon");
+        // nobody listens on a stale socket
+        if (error != ECONNREFUSED || unlink(path.c_str()) != 0)
+            throw std::runtime_error("It was not possible to replace the socket " + path);
+    }
+}
+
+SolverDaemon::Connection::~Connection()
+{
+    close(fd);
+}
+
+SolverDaemon::SolverDaemon(const std::string &path,
+                           unsigned int workers,
+                           std::size_t batchSize,
+                           std::size_t maxProblems)
+    : path_(path), workers_(workers), batchSize_(batchSize), maxProblems_(maxProblems)
+{
+    if (workers_ == 0)
+        workers_ = std::max(1u, std::thread::hardware_concurrency());
+    if (batchSize_ == 0)
+        throw std::invalid_argument("The batch size must be positive!");
+}
+
+SolverDaemon::~SolverDaemon()
+{
+    stop();
+}
+
+void SolverDaemon::start()
+{
+    if (running_)
+        return;
+    auto address = socketAddress(path_);
+    // a socket file left by a previous daemon would make bind fail
+    removeStaleSocket(path_, address);
+    listenFd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd_ < 0)
+        throw std::runtime_error("It was not possible to create the socket");
+    // only the owner can connect, the permissions are set before the daemon listens
+    if (bind(listenFd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        chmod(path_.c_str(), 0600) != 0 || listen(listenFd_, 128) != 0)
+    {
+        close(listenFd_);
+        listenFd_ = -1;
+        throw std::runtime_error("It was not possible to listen on the socket " + path_);
+    }
+
+    running_ = true;
+    for (unsigned int i = 0; i < workers_; ++i)
+        pool_.emplace_back(&SolverDaemon::work, this);
+    acceptor_ = std::thread(&SolverDaemon::accept, this);
+}
+
+void SolverDaemon::stop()
+{
+    if (!running_.exchange(false))
+        return;
+    // wakes up the acceptor blocked in accept()
+    shutdown(listenFd_, SHUT_RDWR);
+    acceptor_.join();
+    close(listenFd_);
+    listenFd_ = -1;
+    unlink(path_.c_str());
+
+    // wakes up the readers blocked in recv()
+    for (auto &reader : readers_)
+        if (auto connection = reader.connection.lock())
+            shutdown(connection->fd, SHUT_RDWR);
+    for (auto &reader : readers_)
+        reader.thread.join();
+    readers_.clear();
+
+    {
+        // the workers see running_ either before waiting or when notified
+        std::lock_guard<std::mutex> lock(queueMutex_);
+    }
+    queueCondition_.notify_all();
+    for (auto &worker : pool_)
+        worker.join();
+    pool_.clear();
+    queue_.clear();
+}
+
+void SolverDaemon::accept()
+{
+    while (running_)
+    {
+        int fd = ::accept(listenFd_, nullptr, nullptr);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            break;
+        }
+        // joins the readers of the connections already closed
+        for (auto it = readers_.begin(); it != readers_.end();)
+        {
+            if (*it->done)
+            {
+                it->thread.join();
+                it = readers_.erase(it);
+            }
+            else
+                ++it;
+        }
+        auto connection = std::make_shared<Connection>();
+        connection->fd = fd;
+        auto done = std::make_shared<std::atomic<bool>>(false);
+        readers_.push_back({std::thread(&SolverDaemon::read, this, connection, done), connection, done});
+    }
+}
+
+void SolverDaemon::read(std::shared_ptr<Connection> connection, std::shared_ptr<std::atomic<bool>> done)
+{
+    DaemonProtocol::Request request;
+    while (running_ && readFull(connection->fd, &request, sizeof(request)))
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            queue_.push_back({connection, request});
+        }
+        queueCondition_.notify_one();
+    }
+    *done = true;
+}
+
+void SolverDaemon::work()
+{
+    std::vector<Task> batch;
+    std::vector<DaemonProtocol::Response> responses;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCondition_.wait(lock, [this]
+                                 { return !running_ || !queue_.empty(); });
+            if (!running_)
+                return;
+            std::size_t n = std::min(batchSize_, queue_.size());
+            batch.assign(std::make_move_iterator(queue_.begin()), std::make_move_iterator(queue_.begin() + n));
+            queue_.erase(queue_.begin(), queue_.begin() + n);
+        }
+        // the batch may contain requests of several connections, the responses are
+        // grouped by connection and each group is sent with a single write
+        std::stable_sort(batch.begin(), batch.end(), [](const Task &x, const Task &y)
+                         { return x.connection < y.connection; });
+        for (std::size_t begin = 0; begin < batch.size();)
+        {
+            std::size_t end = begin;
+            responses.clear();
+            while (end < batch.size() && batch[end].connection == batch[begin].connection)
+                responses.push_back(solve(batch[end++].request));
+            auto &connection = *batch[begin].connection;
+            {
+                std::lock_guard<std::mutex> lock(connection.writeMutex);
+                // a client that went away just loses its responses
+                writeFull(connection.fd, responses.data(), responses.size() * sizeof(responses[0]));
+            }
+            begin = end;
+        }
+        batch.clear();
+    }
+}
+
+/* Returns the state of the problem, creating it if needed. If the problem has not been
+ * solved yet, guess is replaced by the root of the closest parameter already solved.
+ */
+std::shared_ptr<SolverDaemon::Problem> SolverDaemon::problem(std::uint32_t function, T::ScalarType param,
+                                                             T::VariableType &guess)
+{
+    auto f = functions_.find(function);
+    if (f == functions_.end())
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(problemsMutex_);
+    auto key = std::make_pair(function, param);
+    auto it = problems_.find(key);
+    if (it != problems_.end() && !std::isnan(it->second->root))
+    {
+        guess = it->second->root;
+        return it->second;
+    }
+
+    // closest parameter of the same function with a known root
+    double distance = std::numeric_limits<double>::infinity();
+    auto next = problems_.lower_bound(key);
+    for (auto candidate = next; candidate != problems_.end() && candidate->first.first == function; ++candidate)
+        if (!std::isnan(candidate->second->root))
+        {
+            distance = candidate->first.second - param;
+            guess = candidate->second->root;
+            break;
+        }
+    for (auto candidate = next; candidate != problems_.begin();)
+    {
+        --candidate;
+        if (candidate->first.first != function)
+            break;
+        if (!std::isnan(candidate->second->root))
+        {
+            if (param - candidate->first.second < distance)
+                guess = candidate->second->root;
+            break;
+        }
+    }
+
+    if (it != problems_.end())
+        return it->second;
+    // the caches are emptied when they hold too many problems
+    if (problems_.size() >= maxProblems_)
+        problems_.clear();
+    auto fp = f->second;
+    T::FunctionType fx = [fp, param](const T::VariableType &x)
+    { return fp(x, param); };
+    auto state = std::shared_ptr<Problem>(new Problem{EvaluationCache(fx), std::numeric_limits<T::VariableType>::quiet_NaN()});
+    problems_.emplace(key, state);
+    return state;
+}
+
+DaemonProtocol::Response SolverDaemon::solve(const DaemonProtocol::Request &request)
+{
+    DaemonProtocol::Response response{request.id, DaemonProtocol::Ok, 0u, 0u,
+                                      std::numeric_limits<double>::quiet_NaN(),
+                                      std::numeric_limits<double>::quiet_NaN()};
+    T::VariableType guess = request.a;
+    auto state = problem(request.function, request.param, guess);
+    if (!state)
+    {
+        response.status = DaemonProtocol::UnknownFunction;
+        return response;
+    }
+    auto evaluations = state->cache.getEvaluations();
+    auto f = [&state](const T::VariableType &x)
+    { return state->cache(x); };
+
+    try
+    {
+        Bracket bracket{request.a, request.b, f(request.a), f(request.b)};
+        if (request.a == request.b || bracket.fa * bracket.fb > 0)
+        {
+            bool found;
+            double h = 1e-3 * std::max(1., std::abs(guess));
+            std::tie(bracket, found) = SolverCore::bracketInterval(f, guess, h, SolverCore::bracketMaxIter);
+            if (!found)
+            {
+                response.status = DaemonProtocol::NoBracket;
+                return response;
+            }
+        }
+        SolveReport report;
+        SolverCore::brent(f, bracket, request.tol, 150u, &report);
+        {
+            std::lock_guard<std::mutex> lock(problemsMutex_);
+            state->root = report.root;
+        }
+        response.root = report.root;
+        response.slope = report.slope;
+        response.iterations = report.iterations;
+    }
+    catch (const std::exception &)
+    {
+        response.status = DaemonProtocol::Failed;
+    }
+    response.evaluations = state->cache.getEvaluations() - evaluations;
+    return response;
+}
+
+SolverClient::SolverClient(const std::string &path)
+{
+    auto address = socketAddress(path);
+    fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd_ < 0)
+        throw std::runtime_error("It was not possible to create the socket");
+    if (connect(fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd_);
+        throw std::runtime_error("It was not possible to connect to the solver daemon at " + path);
+    }
+}
+
+SolverClient::~SolverClient()
+{
+    close(fd_);
+}
+
+SolveReport SolverClient::solve(std::uint32_t function, T::ScalarType param,
+                                std::array<T::VariableType, 2> interval, double tol)
+{
+    auto response = solve({{0u, function, param, interval[0], interval[1], tol}}).front();
+    switch (response.status)
+    {
+    case DaemonProtocol::Ok:
+        return {response.root, response.slope, response.iterations};
+    case DaemonProtocol::UnknownFunction:
+        throw std::invalid_argument("The function is not registered on the solver daemon!");
+    case DaemonProtocol::NoBracket:
+        throw std::invalid_argument("It was not possible to find an interval that brackets the zero of f");
+    default:
+        throw std::runtime_error("The solver daemon failed to solve the problem");
+    }
+}
+
+SolveReport SolverClient::solve(std::uint32_t function, T::ScalarType param,
+                                T::VariableType guess, double tol)
+{
+    return solve(function, param, {guess, guess}, tol);
+}
+
+std::vector<DaemonProtocol::Response> SolverClient::solve(std::vector<DaemonProtocol::Request> requests)
+{
+    // requests are sent in windows, so that the daemon never blocks writing the responses
+    // to a client that is still writing its requests
+    constexpr std::size_t window = 256;
+    std::vector<DaemonProtocol::Response> responses(requests.size());
+    std::uint32_t first = nextId_;
+    for (auto &request : requests)
+        request.id = nextId_++;
+
+    for (std::size_t begin = 0; begin < requests.size(); begin += window)
+    {
+        std::size_t n = std::min(window, requests.size() - begin);
+        if (!writeFull(fd_, requests.data() + begin, n * sizeof(requests[0])))
+            throw std::runtime_error("The connection to the solver daemon has been lost");
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            DaemonProtocol::Response response;
+            if (!readFull(fd_, &response, sizeof(response)) || response.id - first >= responses.size())
+                throw std::runtime_error("The connection to the solver daemon has been lost");
+            responses[response.id - first] = response;
+        }
+    }
+    return responses;
+}
@@ -0,0 +1,189 @@
+#ifndef __SOLVER_DAEMON__
+#define __SOLVER_DAEMON__
+
+#include "PortfolioSolver.hpp"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Binary protocol of the solver daemon.
+ * Messages are fixed size structures sent in the native layout, since the daemon serves
+ * only the local machine. A client can send many requests before reading the responses,
+ * which may arrive in any order and are matched to the requests by their id.
+ */
+namespace DaemonProtocol
+{
+    enum Status : std::uint32_t
+    {
+        Ok = 0,
+        UnknownFunction = 1,
+        NoBracket = 2,
+        Failed = 3
+    };
+
+    // Solve f(x; param) = 0 for a registered function, in [a, b] or starting from a if a == b
+    struct Request
+    {
+        std::uint32_t id;
+        std::uint32_t function;
+        double param;
+        double a;
+        double b;
+        double tol;
+    };
+
+    struct Response
+    {
+        std::uint32_t id;
+        std::uint32_t status;
+        std::uint32_t iterations;
+        std::uint32_t evaluations;
+        double root;
+        double slope;
+    };
+}
+
+/* Long-running solver serving requests on a Unix domain socket, so that the cost of the
+ * startup and the warm state are shared by all the requests of all the clients.
+ * The functions are registered on the daemon and the requests refer to them by id,
+ * together with the value of a parameter. The daemon keeps resident
+ * - an evaluation cache for each problem (function and parameter), so that a repeated
+ *   request costs no evaluation of f,
+ * - the roots of the problems already solved, used to start the bracket search of the
+ *   requests without an interval from the root of the closest parameter.
+ * Each connection has a reader thread that queues its requests, and a pool of worker
+ * threads takes them from the queue in batches, regardless of the client, and sends the
+ * responses of a batch to each client with a single write.
+ * Requests with an interval are solved with the Brent search, the ones with a single
+ * point with the Brent search after a bracket search.
+ */
+class SolverDaemon
+{
+public:
+    using T = SolverTraits;
+    using ParametricFunctionType = std::function<T::ReturnType(const T::VariableType &, const T::ScalarType &)>;
+
+private:
+    struct Connection
+    {
+        int fd;
+        std::mutex writeMutex;
+        ~Connection();
+    };
+    struct Task
+    {
+        std::shared_ptr<Connection> connection;
+        DaemonProtocol::Request request;
+    };
+    struct Problem
+    {
+        EvaluationCache cache;
+        T::VariableType root;
+    };
+    struct Reader
+    {
+        std::thread thread;
+        std::weak_ptr<Connection> connection;
+        std::shared_ptr<std::atomic<bool>> done;
+    };
+
+    std::string path_;
+    unsigned int workers_;
+    std::size_t batchSize_;
+    std::size_t maxProblems_;
+    std::map<std::uint32_t, ParametricFunctionType> functions_;
+
+    int listenFd_{-1};
+    std::atomic<bool> running_{false};
+    std::thread acceptor_;
+    std::vector<std::thread> pool_;
+    std::list<Reader> readers_;
+
+    std::deque<Task> queue_;
+    std::mutex queueMutex_;
+    std::condition_variable queueCondition_;
+
+    // Problems solved so far, ordered by function and parameter
+    std::map<std::pair<std::uint32_t, T::ScalarType>, std::shared_ptr<Problem>> problems_;
+    std::mutex problemsMutex_;
+
+    void accept();
+    void read(std::shared_ptr<Connection> connection, std::shared_ptr<std::atomic<bool>> done);
+    void work();
+    DaemonProtocol::Response solve(const DaemonProtocol::Request &request);
+    std::shared_ptr<Problem> problem(std::uint32_t function, T::ScalarType param, T::VariableType &guess);
+
+public:
+    // constructors
+    SolverDaemon(const std::string &path,
+                 unsigned int workers = 0,
+                 std::size_t batchSize = 64,
+                 std::size_t maxProblems = 4096);
+    SolverDaemon(const SolverDaemon &) = delete;
+    SolverDaemon &operator=(const SolverDaemon &) = delete;
+
+    // setters
+    // Functions must be registered before start()
+    void registerFunction(std::uint32_t id, const ParametricFunctionType &f) { functions_[id] = f; };
+
+    // getters
+    const std::string &getPath() const { return path_; };
+    // Number of problems whose evaluations are cached
+    std::size_t getProblems()
+    {
+        std::lock_guard<std::mutex> lock(problemsMutex_);
+        return problems_.size();
+    };
+
+    // methods
+    /* Starts serving the requests in background threads. The socket is accessible only by the
+     * owner. A socket left at the path by a daemon that is no longer running is replaced, while
+     * start() throws if the path is not a socket or a running daemon listens on it.
+     */
+    void start();
+    // Stops serving, the pending requests are dropped
+    void stop();
+
+    // destructor
+    ~SolverDaemon();
+};
+
+/* Client of the solver daemon. The requests of a batch are pipelined, i.e. sent without
+ * waiting for the responses of the previous ones.
+ */
+class SolverClient
+{
+public:
+    using T = SolverTraits;
+
+private:
+    int fd_;
+    std::uint32_t nextId_{0u};
+
+public:
+    // constructors
+    explicit SolverClient(const std::string &path);
+    SolverClient(const SolverClient &) = delete;
+    SolverClient &operator=(const SolverClient &) = delete;
+
+    // methods
+    // Solves f(x; param) = 0 in the interval, an exception is thrown if the daemon fails
+    SolveReport solve(std::uint32_t function, T::ScalarType param,
+                      std::array<T::VariableType, 2> interval, double tol = 1e-8);
+    // Solves f(x; param) = 0 starting from the guess
+    SolveReport solve(std::uint32_t function, T::ScalarType param,
+                      T::VariableType guess, double tol = 1e-8);
+    // Sends all the requests and returns the responses in the same order, the ids are overwritten
+    std::vector<DaemonProtocol::Response> solve(std::vector<DaemonProtocol::Request> requests);
+
+    // destructor
+    ~SolverClient();
+};
+
+#endif // __SOLVER_DAEMON__
@@ -84,6 +84,21 @@ SolverFactory(Args &&...args) noexcept
             return SolverFactory<QuasiNewton>(std::forward<Args>(args)...);
         }
 
+    if constexpr (std::is_same_v<SolverType, ModifiedNewton>)
+        try
+        {
+            // Possible problem: ModifiedNewton is initialized without the derivative of the function
+            return std::make_unique<ModifiedNewton>(std::forward<Args>(args)...);
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << e.what() << std::endl;
+            std::cout << std::endl;
+            std::cout << "Switching to QuasiNewton solver..." << std::endl;
+            std::cout << std::endl;
+            return SolverFactory<QuasiNewton>(std::forward<Args>(args)...);
+        }
+
     if constexpr (std::is_same_v<SolverType, QuasiNewton>)
         try
         {
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <functional>
 #include <exception>
+#include "SolverCore.hpp"
 
 struct SolverTraits
 {
@@ -11,6 +12,14 @@ struct SolverTraits
     using VariableType = double;
     using ReturnType = double;
     using FunctionType = std::function<ReturnType(const VariableType &)>;
+    using ReportType = SolverCore::BasicReport<VariableType, ReturnType>;
+    using BracketType = SolverCore::BasicBracket<VariableType, ReturnType>;
 };
 
+// Outcome of a solve: root, slope of f at the root and number of iterations
+using SolveReport = SolverTraits::ReportType;
+
+// Interval [a, b] together with the values fa = f(a) and fb = f(b)
+using Bracket = SolverTraits::BracketType;
+
 #endif // __SOLVER_TRAITS__
@@ -1,80 +1,49 @@
 #include "Solvers.hpp"
 
-// Secant solve method
-SolverTraits::VariableType Secant::solve()
-{
-    T::ReturnType ya = f_(a_);
-    double resid = std::abs(ya);
-    T::VariableType c{a_};
-    unsigned int iter{0u};
-    double check = tol_ * resid + tola_;
-    bool goOn = resid > check;
-    while (goOn && iter < maxIter_)
-    {
-        ++iter;
-        double yb = f_(b_);
-        double den = (yb - ya);
-        if (den == 0)
-            throw std::overflow_error("Division by zero detected, method stopped.");
-        c = a_ - ya * (b_ - a_) / den;
-        double yc = f_(c);
-        resid = std::abs(yc);
-        goOn = resid > check;
-        ya = yc;
-        a_ = c;
-    }
-
-    if (iter == maxIter_)
-    {
-        throw std::overflow_error("The maximum number of iterations has been reached without convergence!");
-    }
-
-    return c;
-};
-
-// Bisection solve method
-SolverTraits::VariableType Bisection::solve()
-{
-    T::ReturnType ya = f_(a_);
-    double delta = b_ - a_;
-    T::ReturnType yc{ya};
-    T::VariableType c{a_};
-    while (std::abs(delta) > 2 * tol_)
-    {
-        c = (a_ + b_) / 2.;
-        yc = f_(c);
-        if (yc * ya < 0.0)
-        {
-            b_ = c;
-        }
-        else
-        {
-            ya = yc;
-            a_ = c;
-        }
-        delta = b_ - a_;
-    }
-    return (a_ + b_) / 2.;
-};
-
-// Newton solve method
-SolverTraits::VariableType Newton::solve()
+/* ModifiedNewton solve method
+ * Close to a root of multiplicity M the Newton correction u = f/f' behaves like (x - x*) / M,
+ * so after a step of length m * u the ratio of two successive corrections is about 1 - m / M.
+ * The multiplicity is estimated from this ratio and used to scale the step, which restores
+ * the quadratic convergence of the method. An estimate is accepted only when two consecutive
+ * iterations agree on it.
+ */
+SolverTraits::VariableType ModifiedNewton::solve()
 {
 
-    T::VariableType a{x0_};
+    T::VariableType a{bracket_.a};
 
     T::ReturnType ya = f_(a);
     double resid = std::abs(ya);
     unsigned int iter{0u};
     double check = tol_ * resid + tola_;
     bool goOn = resid > check;
+    double m{1.0};
+    double uOld{0.0};
+    unsigned int candidate{1u};
+    multiplicity_ = 1u;
+    T::ReturnType slope = std::numeric_limits<T::ReturnType>::quiet_NaN();
     while (goOn && iter < maxIter_)
     {
         ++iter;
         auto dfa = df_(a);
         if (dfa == 0)
             throw std::overflow_error("Division by zero detected, method stopped.");
-        a += -ya / dfa;
+        slope = dfa;
+        double u = ya / dfa;
+        if (iter > 1 && uOld != 0)
+        {
+            double ratio = u / uOld;
+            if (ratio < 1.0)
+            {
+                auto estimate = static_cast<unsigned int>(std::max(1.0, std::round(m / (1.0 - ratio))));
+                if (estimate == candidate)
+                    multiplicity_ = estimate;
+                candidate = estimate;
+            }
+        }
+        m = multiplicity_;
+        a += -m * u;
+        uOld = u;
         ya = f_(a);
         resid = std::abs(ya);
         goOn = resid > check;
@@ -85,155 +54,43 @@ SolverTraits::VariableType Newton::solve()
         throw std::overflow_error("The maximum number of iterations has been reached without convergence!");
     }
 
+    report_ = {a, slope, iter};
     return a;
 };
 
-// RegulaFalsi solve method
-SolverTraits::VariableType RegulaFalsi::solve()
+/* This function checks that the evaluations of the function at the two ends of the provided bracket have opposite sign.
+ * If this is not the case the function tries to find a valid bracket by calling the function bracketInterval,
+ * reusing the values of the function at the two ends.
+ * In the worst case an exception is thrown. If quiet is true nothing is printed.
+ */
+Bracket checkChangeOfSign(const SolverTraits::FunctionType &f, const Bracket &bracket, bool quiet)
 {
-    T::ReturnType ya = f_(a_);
-    T::ReturnType yb = f_(b_);
-    double delta = b_ - a_;
-    T::ReturnType yc{ya};
-    T::VariableType c{a_};
-    double resid0 = std::max(std::abs(ya), std::abs(yb));
-    double incr = std::numeric_limits<double>::max();
-    constexpr double small = 10.0 * std::numeric_limits<double>::epsilon();
-
-    while (std::abs(yc) > tol_ * resid0 + tola_ && incr > small)
+    if (bracket.fa * bracket.fb > 0)
     {
-        double incra = -ya / (yb - ya);
-        double incrb = 1. - incra;
-        double incr = std::min(incra, incrb);
-        if (!(std::max(incra, incrb) <= 1.0 && incr >= 0))
-            throw std::overflow_error("Chord is failing");
-        c = a_ + incra * delta;
-        yc = f_(c);
-        if (yc * ya < 0.0)
+        if (!quiet)
         {
-            yb = yc;
-            b_ = c;
-        }
-        else
-        {
-            ya = yc;
-            a_ = c;
+            std::cout << "Function must change sign at the two end values!" << std::endl;
+            std::cout << std::endl;
         }
-        delta = b_ - a_;
-    }
-    return c;
-};
 
-// BrentSearch solve method
-SolverTraits::VariableType BrentSearch::solve()
-{
-    T::VariableType a{a_};
-    T::VariableType b{b_};
-
-    T::ReturnType ya = f_(a);
-    T::ReturnType yb = f_(b);
-
-    if (std::abs(ya) < std::abs(yb))
-    {
-        std::swap(a, b);
-        std::swap(ya, yb);
-    }
-
-    T::VariableType c{a};
-    T::VariableType d{c};
-    T::ReturnType yc = ya;
-    bool mflag{true};
-    T::VariableType s = b;
-    T::ReturnType ys = yb;
-    unsigned iter{0u};
+        Bracket new_bracket;
+        bool status;
 
-    do
-    {
-        //
-        if (ya != yc and yb != yc)
-        {
-            auto yab = ya - yb;
-            auto yac = ya - yc;
-            auto ycb = yc - yb;
-            // inverse quadratic interpolation
-            s = a * ya * yc / (yab * yac) + b * ya * yc / (yab * ycb) -
-                c * ya * yb / (yac * ycb);
-        }
-        else
+        if (!quiet)
         {
-            // secant
-            s = b - yb * (b - a) / (yb - ya);
-        }
-        //
-        if (((s - 3 * (a + b) / 4) * (s - b) >= 0) or // condition 1
-            (mflag and
-             (std::abs(s - b) >= 0.5 * std::abs(b - c))) or // condition 2
-            (!mflag and
-             (std::abs(s - b) >= 0.5 * std::abs(c - d))) or // condition 3
-            (mflag and (std::abs(b - c) < tol_)) or         // condition 4
-            (!mflag and (std::abs(c - d) < tol_))           // condition 5
-        )
-        {
-            mflag = true;
-            s = 0.5 * (a + b); // back to bisection step
-        }
-        else
-            mflag = false;
-        //
-        ys = f_(s);
-        d = c;
-        c = b;
-        yc = yb;
-        //
-        if (ya * ys < 0)
-        {
-            b = s;
-            yb = ys;
-        }
-        else
-        {
-            a = s;
-            ya = ys;
-        }
-        //
-        if (std::abs(ya) < std::abs(yb))
-        {
-            std::swap(a, b);
-            std::swap(ya, yb);
+            std::cout << "Trying to find an interval that brackets the zero of f starting from a" << std::endl;
+            std::cout << std::endl;
         }
-        //
-    } while (ys != 0. && std::abs(b - a) > tol_ && iter < maxIter_);
-
-    if (iter == maxIter_)
-        throw std::overflow_error("The maximum number of iterations has been reached without convergence!");
-
-    return s;
-};
-
-/* This function checks that the evaluations of the function at the two ends of the provided interval have opposite sign.
- * If this is not the case the function tries to find a valid interval by calling the function bracketInterval.
- * In the worst case an exception is thrown.
- */
-void checkChangeOfSign(const SolverTraits::FunctionType &f, SolverTraits::VariableType &a, SolverTraits::VariableType &b)
-{
-    if (f(a) * f(b) > 0)
-    {
-        std::cout << "Function must change sign at the two end values!" << std::endl;
-        std::cout << std::endl;
-
-        SolverTraits::VariableType new_a;
-        SolverTraits::VariableType new_b;
-        bool status;
-
-        std::cout << "Trying to find an interval that brackets the zero of f starting from a" << std::endl;
-        std::cout << std::endl;
-        std::tie(new_a, new_b, status) = bracketInterval(f, a);
+        std::tie(new_bracket, status) = SolverCore::bracketInterval(f, bracket.a, bracket.fa, SolverCore::bracketStep, SolverCore::bracketMaxIter);
 
         if (!status)
         {
-            std::cout << "Trying to find an interval that brackets the zero of f starting from b" << std::endl;
-            std::cout << std::endl;
-            std::tie(new_a, new_b, status) = bracketInterval(f, b);
+            if (!quiet)
+            {
+                std::cout << "Trying to find an interval that brackets the zero of f starting from b" << std::endl;
+                std::cout << std::endl;
+            }
+            std::tie(new_bracket, status) = SolverCore::bracketInterval(f, bracket.b, bracket.fb, SolverCore::bracketStep, SolverCore::bracketMaxIter);
         }
 
         if (!status)
@@ -241,32 +98,42 @@ void checkChangeOfSign(const SolverTraits::FunctionType &f, SolverTraits::Variab
             throw std::invalid_argument("It was not possible to find an interval that brackets the zero of f");
         }
 
-        std::cout << "Interval found! " << std::endl
-                  << "Initial interval: a = " << a << ", b = " << b << std::endl
-                  << "New interval: a = " << new_a << ", b = " << new_b << std::endl
-                  << std::endl;
-        a = new_a;
-        b = new_b;
+        if (!quiet)
+            std::cout << "Interval found! " << std::endl
+                      << "Initial interval: a = " << bracket.a << ", b = " << bracket.b << std::endl
+                      << "New interval: a = " << new_bracket.a << ", b = " << new_bracket.b << std::endl
+                      << std::endl;
+        return new_bracket;
     }
+    return bracket;
+}
+
+// Evaluates the function at the two ends of the interval and checks the bracket
+Bracket checkChangeOfSign(const SolverTraits::FunctionType &f, SolverTraits::VariableType a, SolverTraits::VariableType b,
+                          bool quiet)
+{
+    return checkChangeOfSign(f, Bracket{a, b, f(a), f(b)}, quiet);
 }
 
 /* This function searches a valid interval given an initial point.
- * In the worst case an exception is thrown.
+ * In the worst case an exception is thrown. If quiet is true nothing is printed.
  */
-void searchBracketInterval(const SolverTraits::FunctionType &f,
-                           SolverTraits::VariableType x1, SolverTraits::VariableType &a, SolverTraits::VariableType &b)
+Bracket searchBracketInterval(const SolverTraits::FunctionType &f, SolverTraits::VariableType x1, bool quiet)
 {
-    std::cout << "Trying to find an interval that brackets the zero of f starting from the provided point" << std::endl;
-    std::cout << std::endl;
-    auto [new_a, new_b, status] = bracketInterval(f, x1);
+    if (!quiet)
+    {
+        std::cout << "Trying to find an interval that brackets the zero of f starting from the provided point" << std::endl;
+        std::cout << std::endl;
+    }
+    auto [bracket, status] = bracketInterval(f, x1);
     if (status)
     {
-        std::cout << "Interval found! " << std::endl
-                  << "Initial point: x1 = " << x1 << std::endl
-                  << "New interval: a = " << new_a << ", b = " << new_b << std::endl
-                  << std::endl;
-        a = new_a;
-        b = new_b;
+        if (!quiet)
+            std::cout << "Interval found! " << std::endl
+                      << "Initial point: x1 = " << x1 << std::endl
+                      << "New interval: a = " << bracket.a << ", b = " << bracket.b << std::endl
+                      << std::endl;
+        return bracket;
     }
     else
     {
@@ -286,39 +153,14 @@ void searchBracketInterval(const SolverTraits::FunctionType &f,
  * - maxIter: maximum number of iterations
  *
  * Return:
- * It returns a tuple with the bracketing points and a bool which is true if number
- * of iterations not exceeded (bracket found)
+ * It returns a tuple with the bracket (the bracketing points and the values of f
+ * at them) and a bool which is true if number of iterations not exceeded (bracket found)
  */
-std::tuple<SolverTraits::VariableType, SolverTraits::VariableType, bool>
+std::tuple<Bracket, bool>
 bracketInterval(const SolverTraits::FunctionType &f, SolverTraits::VariableType x1,
                 double h, unsigned int maxIter)
 {
-    constexpr double expandFactor = 1.5;
-    h = std::abs(h);
-    auto direction = 1.0;
-    SolverTraits::VariableType x2 = x1 + h;
-    SolverTraits::ReturnType y1 = f(x1);
-    SolverTraits::ReturnType y2 = f(x2);
-    unsigned int iter = 0u;
-
-    // get initial decrement direction
-    while ((y1 * y2 > 0) && (iter < maxIter))
-    {
-        ++iter;
-        if (std::abs(y2) > std::abs(y1))
-        {
-            std::swap(y1, y2);
-            std::swap(x1, x2);
-            // change direction
-        }
-        direction = (x2 > x1) ? 1.0 : -1.0;
-        x1 = x2;
-        y1 = y2;
-        x2 += direction * h;
-        y2 = f(x2);
-        h *= expandFactor;
-    }
-    return std::make_tuple(x1, x2, iter < maxIter);
+    return SolverCore::bracketInterval(f, x1, h, maxIter);
 }
 
 // Approximates the first derivative of a function with centered finite differences
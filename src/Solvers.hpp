@@ -1,37 +1,38 @@
 #ifndef __SOLVERS__
 #define __SOLVERS__
 
-#include "SolverBase.hpp"
+#include "PolicySolver.hpp"
+#include "SolverCore.hpp"
 #include <array>
+#include <cmath>
 #include <limits>
 
-void checkChangeOfSign(const SolverTraits::FunctionType &f,
-                       SolverTraits::VariableType &a, SolverTraits::VariableType &b);
+Bracket checkChangeOfSign(const SolverTraits::FunctionType &f, const Bracket &bracket, bool quiet = false);
 
-void searchBracketInterval(const SolverTraits::FunctionType &f,
-                           SolverTraits::VariableType x1, SolverTraits::VariableType &a, SolverTraits::VariableType &b);
+Bracket checkChangeOfSign(const SolverTraits::FunctionType &f,
+                          SolverTraits::VariableType a, SolverTraits::VariableType b, bool quiet = false);
 
-std::tuple<SolverTraits::VariableType, SolverTraits::VariableType, bool>
+Bracket searchBracketInterval(const SolverTraits::FunctionType &f, SolverTraits::VariableType x1, bool quiet = false);
+
+std::tuple<Bracket, bool>
 bracketInterval(const SolverTraits::FunctionType &f, SolverTraits::VariableType x1,
-                double h = 0.01, unsigned int maxIter = 200);
+                double h = SolverCore::bracketStep, unsigned int maxIter = SolverCore::bracketMaxIter);
 
 double finiteDiff(const SolverTraits::FunctionType &f, const SolverTraits::VariableType x, const double h = 0.001);
 
-class Secant : public SolverBase
-{
-private:
-    T::VariableType a_;
-    T::VariableType b_;
-    double tola_;
-    unsigned int maxIter_;
+/* The solvers are PolicySolvers of the compositions in PolicySolver.hpp, with the constructors
+ * that search or check the bracket. Bisection and RegulaFalsi have no limit on the iterations.
+ */
 
+class Secant : public PolicySecant
+{
 public:
     // constructors
     Secant() = default;
     Secant(const T::FunctionType &f,
            T::VariableType x1,
            double tol = 1e-4,
-           unsigned int maxIter = 150) : SolverBase(f, tol)
+           unsigned int maxIter = 150)
     {
         throw std::invalid_argument("Secant method requires an interval but only one point has been provided!");
     }
@@ -39,56 +40,25 @@ public:
            std::array<T::VariableType, 2> interval,
            double tol = 1e-4,
            double tola = 1e-10,
-           unsigned int maxIter = 150)
-        : SolverBase(f, tol), a_(interval[0]), b_(interval[1]), tola_(tola), maxIter_(maxIter) {}
-
-    // setters
-    void setAbsoluteTollerance(double tola) { tola_ = tola; };
-    void setA(T::VariableType a) { a_ = a; };
-    void setB(T::VariableType b) { b_ = b; };
-
-    // methods
-    T::VariableType solve() override;
+           unsigned int maxIter = 150) : PolicySecant(f, interval, tol, tola, maxIter) {}
 };
 
-class Bisection : public SolverBase
+class Bisection : public PolicyBisection
 {
-private:
-    T::VariableType a_;
-    T::VariableType b_;
-
 public:
     // constructors
     Bisection() = default;
     Bisection(const T::FunctionType &f,
               T::VariableType x1,
-              double tol = 1e-4) : SolverBase(f, tol)
-    {
-        searchBracketInterval(f_, x1, a_, b_);
-    }
+              double tol = 1e-4) : PolicyBisection(f, searchBracketInterval(f, x1), tol, 0., std::numeric_limits<unsigned int>::max()) {}
     Bisection(const T::FunctionType &f, std::array<T::VariableType, 2> interval, double tol = 1e-4)
-        : SolverBase(f, tol), a_(interval[0]), b_(interval[1])
-    {
-        checkChangeOfSign(f_, a_, b_);
-    }
-
-    // setters
-    void setA(T::VariableType a) { a_ = a; };
-    void setB(T::VariableType b) { b_ = b; };
-
-    // methods
-    T::VariableType solve() override;
+        : PolicyBisection(f, checkChangeOfSign(f, interval[0], interval[1]), tol, 0., std::numeric_limits<unsigned int>::max()) {}
+    Bisection(const T::FunctionType &f, const Bracket &bracket, double tol = 1e-4)
+        : PolicyBisection(f, checkChangeOfSign(f, bracket), tol, 0., std::numeric_limits<unsigned int>::max()) {}
 };
 
-class Newton : public SolverBase
+class Newton : public PolicyNewton
 {
-
-protected:
-    T::FunctionType df_;
-    T::VariableType x0_;
-    double tola_;
-    unsigned int maxIter_;
-
 public:
     // constructors
     Newton() = default;
@@ -113,22 +83,20 @@ public:
            T::VariableType x0,
            double tol = 1e-4,
            double tola = 1e-10,
-           unsigned int maxIter = 150) : SolverBase(f, tol), df_(df), x0_(x0), tola_(tola), maxIter_(maxIter) {}
+           unsigned int maxIter = 150) : PolicyNewton(f, df, x0, tol, tola, maxIter) {}
     Newton(const T::FunctionType &f,
            const T::FunctionType &df,
            std::array<T::VariableType, 2> interval,
            double tol = 1e-4,
            double tola = 1e-10,
-           unsigned int maxIter = 150) : Newton(f, interval[0], tol, tola, maxIter){};
+           unsigned int maxIter = 150) : Newton(f, df, interval[0], tol, tola, maxIter){};
 
     // setters
-    void setDerivative(T::FunctionType df) { df_ = df; };
-    void setInitializationPoint(T::VariableType x0) { x0_ = x0; };
-    void setAbsoluteTollerance(double tola) { tola_ = tola; };
-    void setMaxIter(unsigned int maxIter) { maxIter_ = maxIter; };
-
-    // methods
-    T::VariableType solve() override;
+    void setInitializationPoint(T::VariableType x0)
+    {
+        bracket_.a = bracket_.b = x0;
+        forgetValues(bracket_);
+    };
 };
 
 class QuasiNewton : public Newton
@@ -167,68 +135,62 @@ public:
                 unsigned int maxIter = 150) : Newton(f, df, x0, tol, tola, maxIter){};
 };
 
-class RegulaFalsi : public SolverBase
+class ModifiedNewton : public Newton
 {
+
 private:
-    T::VariableType a_;
-    T::VariableType b_;
-    double tola_;
+    unsigned int multiplicity_{1u};
 
 public:
     // constructors
-    RegulaFalsi() = default;
-    RegulaFalsi(const T::FunctionType &f,
-                T::VariableType x1,
-                double tol = 1e-4,
-                double tola = 1e-10) : SolverBase(f, tol), tola_(tola)
-    {
-        searchBracketInterval(f_, x1, a_, b_);
-    }
-    RegulaFalsi(const T::FunctionType &f, std::array<T::VariableType, 2> interval, double tol = 1e-4, double tola = 1e-10)
-        : SolverBase(f, tol), a_(interval[0]), b_(interval[1]), tola_(tola)
-    {
-        checkChangeOfSign(f_, a_, b_);
-    }
+    // ModifiedNewton shares the initialization of Newton
+    using Newton::Newton;
 
     // setters
-    void setA(T::VariableType a) { a_ = a; };
-    void setB(T::VariableType b) { b_ = b; };
-    void setAbsoluteTollerance(double tola) { tola_ = tola; };
+    // The estimate of the multiplicity is not part of the state of a checkpoint, so
+    // ModifiedNewton can not be checkpointed and a non-empty path is rejected
+    void setCheckpoint(const std::string &path) override
+    {
+        if (!path.empty())
+            throw std::invalid_argument("ModifiedNewton does not support checkpoints!");
+    };
+
+    // getters
+    // Multiplicity of the root detected during the last call to solve()
+    unsigned int getMultiplicity() const { return multiplicity_; };
 
     // methods
     T::VariableType solve() override;
 };
 
-class BrentSearch : public SolverBase
+class RegulaFalsi : public PolicyRegulaFalsi
 {
-private:
-    T::VariableType a_;
-    T::VariableType b_;
-    unsigned int maxIter_;
+public:
+    // constructors
+    RegulaFalsi() = default;
+    RegulaFalsi(const T::FunctionType &f,
+                T::VariableType x1,
+                double tol = 1e-4,
+                double tola = 1e-10) : PolicyRegulaFalsi(f, searchBracketInterval(f, x1), tol, tola, std::numeric_limits<unsigned int>::max()) {}
+    RegulaFalsi(const T::FunctionType &f, std::array<T::VariableType, 2> interval, double tol = 1e-4, double tola = 1e-10)
+        : PolicyRegulaFalsi(f, checkChangeOfSign(f, interval[0], interval[1]), tol, tola, std::numeric_limits<unsigned int>::max()) {}
+    RegulaFalsi(const T::FunctionType &f, const Bracket &bracket, double tol = 1e-4, double tola = 1e-10)
+        : PolicyRegulaFalsi(f, checkChangeOfSign(f, bracket), tol, tola, std::numeric_limits<unsigned int>::max()) {}
+};
 
+class BrentSearch : public PolicyBrent
+{
 public:
     // constructors
     BrentSearch() = default;
     BrentSearch(const T::FunctionType &f,
                 T::VariableType x1,
                 double tol = 1e-4,
-                unsigned int maxIter = 150) : SolverBase(f, tol), maxIter_(maxIter)
-    {
-        searchBracketInterval(f_, x1, a_, b_);
-    }
+                unsigned int maxIter = 150) : PolicyBrent(f, searchBracketInterval(f, x1), tol, 0., maxIter) {}
     BrentSearch(const T::FunctionType &f, std::array<T::VariableType, 2> interval, double tol = 1e-4, unsigned int maxIter = 150)
-        : SolverBase(f, tol), a_(interval[0]), b_(interval[1]), maxIter_(maxIter)
-    {
-        checkChangeOfSign(f_, a_, b_);
-    }
-
-    // setters
-    void setA(T::VariableType a) { a_ = a; };
-    void setB(T::VariableType b) { b_ = b; };
-    void setMaxIter(unsigned int maxIter) { maxIter_ = maxIter; };
-
-    // methods
-    T::VariableType solve() override;
+        : PolicyBrent(f, checkChangeOfSign(f, interval[0], interval[1]), tol, 0., maxIter) {}
+    BrentSearch(const T::FunctionType &f, const Bracket &bracket, double tol = 1e-4, unsigned int maxIter = 150)
+        : PolicyBrent(f, checkChangeOfSign(f, bracket), tol, 0., maxIter) {}
 };
 
 #endif // __SOLVERS__
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include "SweepRunner.hpp"
+
+#include <algorithm>
+#include <csignal>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <limits>
+#include <thread>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    // Reads exactly size bytes, returns false on end of file or error
+    bool readFull(int fd, void *buffer, std::size_t size)
+    {
+        auto *data = static_cast<char *>(buffer);
+        while (size > 0)
+        {
+            ssize_t n = ::read(fd, data, size);
+            if (n <= 0)
+                return false;
+            data += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    // Writes exactly size bytes, returns false on error
+    bool writeFull(int fd, const void *buffer, std::size_t size)
+    {
+        const auto *data = static_cast<const char *>(buffer);
+        while (size > 0)
+        {
+            ssize_t n = ::write(fd, data, size);
+            if (n <= 0)
+                return false;
+            data += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    /* Reads from the non-blocking descriptor what is available, up to size bytes in total in
+     * the buffer. Returns false on end of file or error.
+     */
+    bool readAvailable(int fd, std::vector<char> &buffer, std::size_t size)
+    {
+        while (buffer.size() < size)
+        {
+            char chunk[4096];
+            ssize_t n = ::read(fd, chunk, std::min(sizeof(chunk), size - buffer.size()));
+            if (n > 0)
+                buffer.insert(buffer.end(), chunk, chunk + n);
+            else if (n < 0 && errno == EINTR)
+                continue;
+            else
+                return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+        return true;
+    }
+
+    /* Owns the pool of workers and the SIGPIPE handler of a sweep. Whenever the sweep ends, even
+     * by an exception, the pipes are closed, the workers are reaped and the previous handler is
+     * restored. The workers of an incomplete sweep are killed, the others exit when their command
+     * pipe is closed.
+     */
+    template <class Worker>
+    class PoolGuard
+    {
+        std::vector<Worker> &pool_;
+        void (*previousHandler_)(int);
+
+    public:
+        bool completed{false};
+
+        explicit PoolGuard(std::vector<Worker> &pool)
+            : pool_(pool), previousHandler_(std::signal(SIGPIPE, SIG_IGN)) {}
+        PoolGuard(const PoolGuard &) = delete;
+        PoolGuard &operator=(const PoolGuard &) = delete;
+
+        ~PoolGuard()
+        {
+            for (auto &worker : pool_)
+            {
+                if (worker.pid <= 0)
+                    continue;
+                if (!completed)
+                    ::kill(worker.pid, SIGKILL);
+                ::close(worker.command);
+                ::close(worker.result);
+                ::waitpid(worker.pid, nullptr, 0);
+            }
+            std::signal(SIGPIPE, previousHandler_);
+        }
+    };
+}
+
+SweepRunner::SweepRunner(const ProblemType &problem,
+                         unsigned int workers,
+                         std::size_t shardSize,
+                         double timeout,
+                         unsigned int maxAttempts)
+    : problem_(problem), workers_(workers), shardSize_(shardSize), timeout_(timeout), maxAttempts_(maxAttempts)
+{
+    if (workers_ == 0)
+        workers_ = std::max(1u, std::thread::hardware_concurrency());
+    if (shardSize_ == 0)
+        throw std::invalid_argument("The shard size must be positive!");
+}
+
+// Worker loop: solves the shards whose index is read from command until the pipe is closed
+void SweepRunner::work(const std::vector<T::ScalarType> &params, int command, int result) const
+{
+    std::int64_t shard;
+    std::vector<T::VariableType> solutions;
+    while (readFull(command, &shard, sizeof(shard)))
+    {
+        std::size_t begin = shard * shardSize_;
+        std::size_t end = std::min(begin + shardSize_, params.size());
+        solutions.resize(end - begin);
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            try
+            {
+                solutions[i - begin] = problem_(params[i]);
+            }
+            catch (const std::exception &)
+            {
+                solutions[i - begin] = std::numeric_limits<T::VariableType>::quiet_NaN();
+            }
+        }
+        if (!writeFull(result, &shard, sizeof(shard)) ||
+            !writeFull(result, solutions.data(), solutions.size() * sizeof(T::VariableType)))
+            break;
+    }
+}
+
+SweepRunner::Worker SweepRunner::spawn(const std::vector<T::ScalarType> &params, const std::vector<Worker> &pool) const
+{
+    int command[2], result[2];
+    if (::pipe(command) != 0)
+        throw std::runtime_error("It was not possible to create the pipes of a worker");
+    if (::pipe(result) != 0)
+    {
+        ::close(command[0]);
+        ::close(command[1]);
+        throw std::runtime_error("It was not possible to create the pipes of a worker");
+    }
+
+    // Buffered output would be duplicated in the child
+    std::cout.flush();
+    std::cerr.flush();
+
+    pid_t pid = ::fork();
+    if (pid < 0)
+    {
+        for (int fd : {command[0], command[1], result[0], result[1]})
+            ::close(fd);
+        throw std::runtime_error("It was not possible to fork a worker");
+    }
+
+    if (pid == 0)
+    {
+        // The worker never returns from spawn: an exception unwinding through the copy of the
+        // coordinator's stack would kill the other workers and run the caller's code twice
+        int status = 0;
+        try
+        {
+            // The worker keeps only its own ends of its pipes
+            for (const auto &worker : pool)
+            {
+                ::close(worker.command);
+                ::close(worker.result);
+            }
+            ::close(command[1]);
+            ::close(result[0]);
+            work(params, command[0], result[1]);
+            std::cout.flush();
+        }
+        catch (...)
+        {
+            status = 1;
+        }
+        ::_exit(status);
+    }
+
+    ::close(command[0]);
+    ::close(result[1]);
+    // the coordinator reads the results without blocking
+    ::fcntl(result[0], F_SETFL, ::fcntl(result[0], F_GETFL) | O_NONBLOCK);
+    return {pid, command[1], result[0], -1, {}, {}};
+}
+
+std::vector<SolverTraits::VariableType> SweepRunner::run(const std::vector<T::ScalarType> &params) const
+{
+    const std::size_t nShards = (params.size() + shardSize_ - 1) / shardSize_;
+    std::vector<T::VariableType> solutions(params.size());
+    std::deque<std::size_t> pending;
+    for (std::size_t s = 0; s < nShards; ++s)
+        pending.push_back(s);
+    std::vector<unsigned int> attempts(nShards, 0u);
+    std::size_t completed = 0;
+
+    std::vector<Worker> pool;
+    // A dead worker must show up as a failed write, not kill the coordinator
+    PoolGuard<Worker> guard(pool);
+    for (unsigned int w = 0; w < std::min<std::size_t>(workers_, nShards); ++w)
+        pool.push_back(spawn(params, pool));
+
+    // Kills the worker, puts its shard back in the queue and replaces it with a new one
+    auto replace = [&](Worker &worker)
+    {
+        ::kill(worker.pid, SIGKILL);
+        ::waitpid(worker.pid, nullptr, 0);
+        ::close(worker.command);
+        ::close(worker.result);
+        // the descriptors may be reused by the pipes of the new worker, and the pid by any process
+        worker.pid = -1;
+        worker.command = worker.result = -1;
+        if (attempts[worker.shard] >= maxAttempts_)
+            throw std::runtime_error("A shard of the sweep failed on all the attempts");
+        pending.push_front(worker.shard);
+        worker = spawn(params, pool);
+    };
+
+    while (completed < nShards)
+    {
+        // assign the pending shards to the idle workers
+        for (auto &worker : pool)
+        {
+            if (worker.shard >= 0 || pending.empty())
+                continue;
+            std::int64_t shard = pending.front();
+            pending.pop_front();
+            worker.shard = shard;
+            worker.start = std::chrono::steady_clock::now();
+            worker.received.clear();
+            ++attempts[shard];
+            if (!writeFull(worker.command, &shard, sizeof(shard)))
+                replace(worker);
+        }
+
+        std::vector<pollfd> fds;
+        for (const auto &worker : pool)
+            fds.push_back({worker.shard >= 0 ? worker.result : -1, POLLIN, 0});
+        ::poll(fds.data(), fds.size(), 100);
+
+        auto now = std::chrono::steady_clock::now();
+        for (std::size_t w = 0; w < pool.size(); ++w)
+        {
+            auto &worker = pool[w];
+            if (worker.shard < 0)
+                continue;
+
+            // the index of the shard followed by its solutions
+            std::size_t begin = worker.shard * shardSize_;
+            std::size_t end = std::min(begin + shardSize_, params.size());
+            std::size_t size = sizeof(std::int64_t) + (end - begin) * sizeof(T::VariableType);
+            bool alive = fds[w].revents == 0 || readAvailable(worker.result, worker.received, size);
+            if (alive && worker.received.size() == size)
+            {
+                std::int64_t shard;
+                std::memcpy(&shard, worker.received.data(), sizeof(shard));
+                if (shard != worker.shard)
+                {
+                    replace(worker);
+                    continue;
+                }
+                std::memcpy(solutions.data() + begin, worker.received.data() + sizeof(shard),
+                            (end - begin) * sizeof(T::VariableType));
+                worker.shard = -1;
+                ++completed;
+            }
+            // a partial result does not extend the timeout
+            else if (!alive || std::chrono::duration<double>(now - worker.start).count() > timeout_)
+                replace(worker);
+        }
+    }
+
+    // closing the command pipes makes the workers exit
+    guard.completed = true;
+    return solutions;
+}
@@ -0,0 +1,67 @@
+#ifndef __SWEEP_RUNNER__
+#define __SWEEP_RUNNER__
+
+#include "SolverTraits.hpp"
+#include <sys/types.h>
+#include <chrono>
+#include <vector>
+
+/* Runs a parameter sweep, i.e. solves one problem for each value of a parameter,
+ * sharding the parameters across a pool of local worker processes.
+ * Workers are forked from the coordinator, so the problem can be any callable, and they
+ * receive the indices of the shards to solve on a pipe and send the results back on another.
+ * The coordinator merges the results in the order of the parameters. A shard is assigned
+ * again to a new worker when its worker dies or does not send its whole result within the
+ * timeout: the results are read without blocking, so a worker that stops in the middle of a
+ * result does not stall the coordinator.
+ * If the problem throws a std::exception, the result for that parameter is NaN; any other
+ * exception ends the worker, as if it had crashed.
+ */
+class SweepRunner
+{
+public:
+    using T = SolverTraits;
+    // Solves the problem associated to a value of the parameter, e.g. by building a solver
+    using ProblemType = std::function<T::VariableType(const T::ScalarType &)>;
+
+private:
+    struct Worker
+    {
+        pid_t pid;
+        int command;
+        int result;
+        long shard;
+        std::chrono::steady_clock::time_point start;
+        // bytes of the result of the shard received so far
+        std::vector<char> received;
+    };
+
+    ProblemType problem_;
+    unsigned int workers_;
+    std::size_t shardSize_;
+    double timeout_;
+    unsigned int maxAttempts_;
+
+    Worker spawn(const std::vector<T::ScalarType> &params, const std::vector<Worker> &pool) const;
+    void work(const std::vector<T::ScalarType> &params, int command, int result) const;
+
+public:
+    // constructors
+    SweepRunner(const ProblemType &problem,
+                unsigned int workers = 0,
+                std::size_t shardSize = 64,
+                double timeout = 60.,
+                unsigned int maxAttempts = 3);
+
+    // setters
+    void setWorkers(unsigned int workers) { workers_ = workers; };
+    void setShardSize(std::size_t shardSize) { shardSize_ = shardSize; };
+    // Seconds after which a shard is considered lost and assigned to another worker
+    void setTimeout(double timeout) { timeout_ = timeout; };
+
+    // methods
+    // Returns the solutions of the problem for all the parameters, in the same order
+    std::vector<T::VariableType> run(const std::vector<T::ScalarType> &params) const;
+};
+
+#endif // __SWEEP_RUNNER__
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <iomanip>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SolverDaemon.hpp"
+
+/* Solver daemon and load generator.
+ *   ./main_daemon                                        runs a daemon and the benchmark in one process
+ *   ./main_daemon serve [socket]                         runs the daemon until interrupted
+ *   ./main_daemon bench [socket] [clients] [requests]    runs the benchmark against a running daemon
+ */
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Registers the functions served by the daemon
+    void registerFunctions(SolverDaemon &daemon)
+    {
+        // 0: p - exp{pi*x}, the root is log(p)/pi
+        daemon.registerFunction(0u, [](const double &x, const double &p)
+                                { return p - std::exp(M_PI * x); });
+        // 1: x^3 - p, the root is cbrt(p)
+        daemon.registerFunction(1u, [](const double &x, const double &p)
+                                { return x * x * x - p; });
+    }
+
+    // Parameter of the i-th request, the requests cycle over 100 distinct problems
+    double parameter(unsigned int i)
+    {
+        return 0.1 + 0.1 * (i % 100);
+    }
+
+    void bench(const std::string &path, unsigned int clients, unsigned int requests)
+    {
+        std::cout << "Clients: " << clients << ", requests per client: " << requests << std::endl;
+        std::cout << std::endl;
+
+        // one request at a time, every client
+        std::vector<std::vector<double>> latencies(clients);
+        std::vector<double> errors(clients, 0.);
+        auto start = Clock::now();
+        std::vector<std::thread> threads;
+        for (unsigned int c = 0; c < clients; ++c)
+            threads.emplace_back([&, c]
+                                 {
+                SolverClient client(path);
+                for (unsigned int i = 0; i < requests; ++i)
+                {
+                    double p = parameter(i + c);
+                    auto t0 = Clock::now();
+                    auto report = client.solve(0u, p, 0., 1e-10);
+                    latencies[c].push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+                    errors[c] = std::max(errors[c], std::abs(report.root - std::log(p) / M_PI));
+                } });
+        for (auto &thread : threads)
+            thread.join();
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::vector<double> all;
+        for (const auto &l : latencies)
+            all.insert(all.end(), l.begin(), l.end());
+        std::sort(all.begin(), all.end());
+        std::cout << "Single requests:" << std::endl;
+        std::cout << "- Throughput:    " << all.size() / elapsed << " solves/s" << std::endl;
+        std::cout << "- Latency p50:   " << all[all.size() / 2] << " us" << std::endl;
+        std::cout << "- Latency p99:   " << all[all.size() * 99 / 100] << " us" << std::endl;
+        std::cout << "- Maximum error: " << *std::max_element(errors.begin(), errors.end()) << std::endl;
+        std::cout << std::endl;
+
+        // pipelined batches, every client
+        start = Clock::now();
+        threads.clear();
+        for (unsigned int c = 0; c < clients; ++c)
+            threads.emplace_back([&, c]
+                                 {
+                SolverClient client(path);
+                std::vector<DaemonProtocol::Request> batch(requests);
+                for (unsigned int i = 0; i < requests; ++i)
+                    batch[i] = {0u, 1u, parameter(i + c), 0., 0., 1e-10};
+                auto responses = client.solve(batch);
+                for (unsigned int i = 0; i < requests; ++i)
+                    errors[c] = std::max(errors[c], std::abs(responses[i].root - std::cbrt(parameter(i + c)))); });
+        for (auto &thread : threads)
+            thread.join();
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        std::cout << "Pipelined batches:" << std::endl;
+        std::cout << "- Throughput:    " << clients * requests / elapsed << " solves/s" << std::endl;
+        std::cout << "- Maximum error: " << *std::max_element(errors.begin(), errors.end()) << std::endl;
+        std::cout << std::endl;
+
+        // the same solves in process, without the daemon and its caches
+        start = Clock::now();
+        double error{0.};
+        for (unsigned int i = 0; i < requests; ++i)
+        {
+            double p = parameter(i);
+            auto f = [p](double x)
+            { return p - std::exp(M_PI * x); };
+            auto [bracket, found] = SolverCore::bracketInterval(f, 0., 1e-3, 200u);
+            if (found)
+                error = std::max(error, std::abs(SolverCore::brent(f, bracket, 1e-10, 150u) - std::log(p) / M_PI));
+        }
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        std::cout << "In process, cold solves:" << std::endl;
+        std::cout << "- Throughput:    " << requests / elapsed << " solves/s" << std::endl;
+        std::cout << "- Maximum error: " << error << std::endl;
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string mode = argc > 1 ? argv[1] : "";
+    std::string path = argc > 2 ? argv[2] : "/tmp/solver_daemon.sock";
+    unsigned int clients = argc > 3 ? std::stoul(argv[3]) : 4u;
+    unsigned int requests = argc > 4 ? std::stoul(argv[4]) : 2000u;
+
+    std::cout << std::endl;
+    std::cout << "#################" << std::endl;
+    std::cout << "# Solver daemon #" << std::endl;
+    std::cout << "#################" << std::endl;
+    std::cout << std::endl;
+
+    if (mode == "serve")
+    {
+        // the signals are blocked in all the threads and waited for by the main one
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        SolverDaemon daemon(path);
+        registerFunctions(daemon);
+        daemon.start();
+        std::cout << "Serving on " << path << std::endl;
+        int signal;
+        sigwait(&signals, &signal);
+        daemon.stop();
+        std::cout << "Stopped" << std::endl;
+    }
+    else if (mode == "bench")
+        bench(path, clients, requests);
+    else
+    {
+        SolverDaemon daemon(path);
+        registerFunctions(daemon);
+        daemon.start();
+        bench(path, clients, requests);
+    }
+
+    return 0;
+}
@@ -1,9 +1,47 @@
 #include <iostream>
+#include <iomanip>
 #include <cmath>
 
 #include "Solvers.hpp"
 #include "basicZeroFun.hpp"
 #include "SolverFactory.hpp"
+#include "IntervalNewton.hpp"
+#include "ChebyshevProxy.hpp"
+#include "InverseSolver.hpp"
+#include "SweepRunner.hpp"
+#include "MixedPrecision.hpp"
+#include "PolicySolver.hpp"
+#include "PortfolioSolver.hpp"
+#include "RootCache.hpp"
+#include "RootSensitivity.hpp"
+#include "SampledFunction.hpp"
+#include "SolverDaemon.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Batch of problems x^3 + x - p = 0 of Test 15, in its own function because GCC optimizes for
+ * size the code that runs only once in main, and it would not vectorize the screening there.
+ */
+std::vector<double> solveBatch15(const std::vector<double> &params)
+{
+    auto ff = [](const float x, const float p)
+    { return x * x * x + x - p; };
+    auto fd = [](const double x, const double p)
+    { return x * x * x + x - p; };
+    return MixedPrecision::solveBatch(ff, fd, params, {0., 2.}, 1e-10);
+}
 
 int main(int argc, char **argv)
 {
@@ -232,5 +270,915 @@ int main(int argc, char **argv)
     std::cout << "Zero: " << result8 << std::endl;
     std::cout << std::endl;
 
+    // ModifiedNewton
+    std::cout << std::endl;
+    std::cout << "############################################" << std::endl;
+    std::cout << "# Test 9: ModifiedNewton at repeated roots #" << std::endl;
+    std::cout << "############################################" << std::endl;
+    std::cout << std::endl;
+
+    for (unsigned int p : {2u, 3u})
+    {
+        // The derivative is wrapped to count the iterations, one evaluation each
+        unsigned int iterN{0u}, iterMN{0u};
+        SolverTraits::FunctionType f9{
+            [p](const double x)
+            { return std::pow(x - 1., p); }};
+        SolverTraits::FunctionType df9N{
+            [p, &iterN](const double x)
+            { ++iterN; return p * std::pow(x - 1., p - 1); }};
+        SolverTraits::FunctionType df9MN{
+            [p, &iterMN](const double x)
+            { ++iterMN; return p * std::pow(x - 1., p - 1); }};
+
+        Newton solver9_N(f9, df9N, 2., 1e-12, 1e-30, 150);
+        ModifiedNewton solver9_MN(f9, df9MN, 2., 1e-12, 1e-30, 150);
+        auto result9_N = solver9_N.solve();
+        auto result9_MN = solver9_MN.solve();
+
+        std::cout << "Function: (x - 1)^" << p << std::endl;
+        std::cout << "- Newton:         " << result9_N << " (" << iterN << " iterations)" << std::endl;
+        std::cout << "- ModifiedNewton: " << result9_MN << " (" << iterMN << " iterations, "
+                  << "multiplicity " << solver9_MN.getMultiplicity() << ")" << std::endl;
+        std::cout << std::endl;
+    }
+
+    // IntervalNewton
+    std::cout << std::endl;
+    std::cout << "##############################################################" << std::endl;
+    std::cout << "# Test 10: IntervalNewton, certified search of all the roots #" << std::endl;
+    std::cout << "##############################################################" << std::endl;
+    std::cout << std::endl;
+
+    // Interval extensions of f and df
+    IntervalNewton::IntervalFunctionType F{
+        [](const Interval &x)
+        { return 0.5 - exp(Interval::pi() * x); }};
+    IntervalNewton::IntervalFunctionType dF{
+        [](const Interval &x)
+        { return -Interval::pi() * exp(Interval::pi() * x); }};
+
+    IntervalNewton solver10(F, dF, std::array<SolverTraits::VariableType, 2>{-1, 0}, 1e-10);
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+    std::cout << "- SolverBase:    " << solver10.solve() << std::endl;
+    std::cout << std::endl;
+
+    // A double root, where f does not change sign, and two roots closer than the sampling step
+    IntervalNewton::IntervalFunctionType F10{
+        [](const Interval &x)
+        { return sqr(x - 1.) * (x - 2.) * (x - 2.001); }};
+    IntervalNewton::IntervalFunctionType dF10{
+        [](const Interval &x)
+        { return 2. * (x - 1.) * (x - 2.) * (x - 2.001) + sqr(x - 1.) * (2. * x - 4.001); }};
+
+    IntervalNewton solver10_1(F10, dF10, std::array<SolverTraits::VariableType, 2>{-3, 5}, 1e-10);
+    std::cout << "Function: (x - 1)^2 * (x - 2) * (x - 2.001)" << std::endl;
+    std::cout << std::setprecision(12);
+    for (const auto &root : solver10_1.solveAll())
+        std::cout << "- Enclosure: " << root.enclosure << (root.unique ? " (unique)" : " (not verified)") << std::endl;
+    // the same search by a single thread
+    solver10_1.setThreads(1);
+    std::cout << "- Enclosures found by 1 thread: " << solver10_1.solveAll().size() << " (expected 3)" << std::endl;
+    std::cout << std::setprecision(6);
+    std::cout << std::endl;
+
+    // A root on the boundary of the domain
+    IntervalNewton solver10_2(IntervalNewton::IntervalFunctionType([](const Interval &x)
+                                                                   { return x; }),
+                              IntervalNewton::IntervalFunctionType([](const Interval &)
+                                                                   { return Interval(1.); }),
+                              std::array<SolverTraits::VariableType, 2>{0, 1}, 1e-10);
+    std::cout << "Function: x" << std::endl;
+    for (const auto &root : solver10_2.solveAll())
+        std::cout << "- Enclosure in [0, 1]: " << root.enclosure << (root.unique ? " (unique)" : " (not verified)") << std::endl;
+    std::cout << std::endl;
+
+    // ChebyshevProxy
+    std::cout << std::endl;
+    std::cout << "###############################################################" << std::endl;
+    std::cout << "# Test 11: ChebyshevProxy, all the roots with few evaluations #" << std::endl;
+    std::cout << "###############################################################" << std::endl;
+    std::cout << std::endl;
+
+    ChebyshevProxy solver11(f, df, std::array<SolverTraits::VariableType, 2>{-1, 0});
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+    std::cout << "- SolverBase:    " << solver11.solve() << " (" << solver11.getEvaluations() << " evaluations)" << std::endl;
+    std::cout << std::endl;
+
+    SolverTraits::FunctionType f11{
+        [](const double x)
+        { return std::cos(10 * x) + 0.2; }};
+    ChebyshevProxy solver11_1(f11, std::array<SolverTraits::VariableType, 2>{-3, 3}, 1e-10);
+    auto roots11 = solver11_1.solveAll();
+    double maxResid11{0.};
+    for (auto x : roots11)
+        maxResid11 = std::max(maxResid11, std::abs(f11(x)));
+    std::cout << "Function: cos(10x) + 0.2" << std::endl;
+    std::cout << "- Roots found: " << roots11.size() << " (expected 20)" << std::endl;
+    std::cout << "- Max residual: " << maxResid11 << std::endl;
+    std::cout << "- Evaluations: " << solver11_1.getEvaluations() << std::endl;
+    std::cout << std::endl;
+
+    // the root of a linear interpolant is outside the interval
+    ChebyshevProxy solver11_2(SolverTraits::FunctionType([](const double x)
+                                                         { return x + 5; }),
+                              std::array<SolverTraits::VariableType, 2>{-1, 1});
+    std::cout << "Function: x + 5" << std::endl;
+    std::cout << "- Roots found in [-1, 1]: " << solver11_2.solveAll().size() << " (expected 0)" << std::endl;
+    std::cout << std::endl;
+
+    // InverseSolver
+    std::cout << std::endl;
+    std::cout << "#################################################" << std::endl;
+    std::cout << "# Test 12: InverseSolver, many targets f(x) = y #" << std::endl;
+    std::cout << "#################################################" << std::endl;
+    std::cout << std::endl;
+
+    // f is wrapped to count the evaluations
+    unsigned int evaluations12{0u};
+    SolverTraits::FunctionType f12{
+        [&f, &evaluations12](const double x)
+        { ++evaluations12; return f(x); }};
+    InverseSolver solver12(f12, std::array<SolverTraits::VariableType, 2>{-1, 0});
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Setup evaluations: " << evaluations12 << std::endl;
+
+    auto y12 = -0.25;
+    BrentSearch solver12_B(SolverTraits::FunctionType([&f, y12](const double x)
+                                                      { return f(x) - y12; }),
+                           std::array<SolverTraits::VariableType, 2>{-1, 0}, 1.e-10);
+    std::cout << "- Target y = " << y12 << ", BrentSearch: " << solver12_B.solve()
+              << ", InverseSolver: " << solver12.solve(y12) << std::endl;
+
+    std::vector<SolverTraits::ReturnType> targets12(100000);
+    auto range12 = solver12.getRange();
+    for (std::size_t k = 0; k < targets12.size(); ++k)
+        targets12[k] = range12[0] + (range12[1] - range12[0]) * k / (targets12.size() - 1);
+    evaluations12 = 0u;
+    auto roots12 = solver12.solve(targets12);
+    double maxResid12{0.};
+    for (std::size_t k = 0; k < targets12.size(); ++k)
+        maxResid12 = std::max(maxResid12, std::abs(f(roots12[k]) - targets12[k]));
+    std::cout << "- Batch of " << targets12.size() << " targets: max residual " << maxResid12
+              << ", " << evaluations12 << " evaluations" << std::endl;
+    std::cout << std::endl;
+
+    // Most of the segments of a steep function fall in the first buckets. f is not evaluated
+    // for the targets out of range, it would throw
+    InverseSolver solver12_1([](const double x)
+                             {
+                                 if (x < 0 || x > 1)
+                                     throw std::domain_error("f evaluated outside [0, 1]");
+                                 return std::exp(20 * x); }, std::array<SolverTraits::VariableType, 2>{0, 1});
+    std::vector<SolverTraits::ReturnType> targets12_1{1.5, 10., 1e3, 1e8, 1e9};
+    auto roots12_1 = solver12_1.solve(targets12_1);
+    std::cout << "Function: exp{20x}" << std::endl;
+    for (std::size_t k = 0; k < targets12_1.size(); ++k)
+        std::cout << "- Target y = " << targets12_1[k] << ": " << roots12_1[k] << ", expected "
+                  << (targets12_1[k] <= std::exp(20.) ? std::log(targets12_1[k]) / 20 : std::nan("")) << std::endl;
+    std::cout << std::endl;
+
+    // SolverCore
+    std::cout << std::endl;
+    std::cout << "###############################################" << std::endl;
+    std::cout << "# Test 13: compile-time roots with SolverCore #" << std::endl;
+    std::cout << "###############################################" << std::endl;
+    std::cout << std::endl;
+
+    // The roots are computed by the compiler, there is no work left at runtime
+    constexpr auto f13 = [](const double x)
+    { return x * x * x - 2. * x - 5.; };
+    constexpr auto df13 = [](const double x)
+    { return 3. * x * x - 2.; };
+    constexpr double expected13 = 2.0945514815423265;
+
+    constexpr auto result13_S = SolverCore::secant(f13, 2., 3., 0., 1e-12, 150);
+    constexpr auto result13_B = SolverCore::bisection(f13, 2., 3., 1e-12);
+    constexpr auto result13_N = SolverCore::newton(f13, df13, 2., 0., 1e-12, 150);
+    constexpr auto result13_BS = SolverCore::brent(f13, 2., 3., 1e-12, 150);
+    static_assert(SolverCore::abs(result13_S - expected13) < 1e-10);
+    static_assert(SolverCore::abs(result13_B - expected13) < 1e-10);
+    static_assert(SolverCore::abs(result13_N - expected13) < 1e-10);
+    static_assert(SolverCore::abs(result13_BS - expected13) < 1e-10);
+
+    std::cout << std::setprecision(12);
+    std::cout << "Function: x^3 - 2x - 5" << std::endl;
+    std::cout << "- Expected zero: " << expected13 << std::endl;
+    std::cout << "- Secant:        " << result13_S << std::endl;
+    std::cout << "- Bisection:     " << result13_B << std::endl;
+    std::cout << "- Newton:        " << result13_N << std::endl;
+    std::cout << "- BrentSearch:   " << result13_BS << std::endl;
+    std::cout << std::setprecision(6);
+    std::cout << std::endl;
+
+    // SweepRunner
+    std::cout << std::endl;
+    std::cout << "###########################################################" << std::endl;
+    std::cout << "# Test 14: SweepRunner, sharded sweep on worker processes #" << std::endl;
+    std::cout << "###########################################################" << std::endl;
+    std::cout << std::endl;
+
+    // Flag shared by the worker processes, used to simulate the crash of the first worker
+    // that meets the parameter 0.5
+    auto *crashed14 = static_cast<int *>(mmap(nullptr, sizeof(int), PROT_READ | PROT_WRITE,
+                                              MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+    *crashed14 = 0;
+    SweepRunner::ProblemType problem14{
+        [crashed14](const double p)
+        {
+            if (p == 0.5 && !__atomic_exchange_n(crashed14, 1, __ATOMIC_SEQ_CST))
+                _exit(1);
+            // Each problem is solved many times to make it expensive
+            double root{0.};
+            for (unsigned int k = 0; k < 200; ++k)
+            {
+                BrentSearch solver(SolverTraits::FunctionType([p](const double x)
+                                                              { return p - std::exp(M_PI * x); }),
+                                   std::array<SolverTraits::VariableType, 2>{-1, 0}, 1.e-10);
+                root = solver.solve();
+            }
+            return root;
+        }};
+
+    std::vector<SolverTraits::ScalarType> params14(4000);
+    for (std::size_t k = 0; k < params14.size(); ++k)
+        params14[k] = 0.05 + 0.9 * k / (params14.size() - 1);
+    params14[params14.size() / 2] = 0.5;
+
+    std::cout << "Function: p - exp{pi*x}, " << params14.size() << " values of p" << std::endl;
+    for (unsigned int workers : {1u, 4u})
+    {
+        auto start14 = std::chrono::steady_clock::now();
+        SweepRunner runner14(problem14, workers, 100);
+        auto roots14 = runner14.run(params14);
+        std::chrono::duration<double> elapsed14 = std::chrono::steady_clock::now() - start14;
+        double maxErr14{0.};
+        for (std::size_t k = 0; k < params14.size(); ++k)
+            maxErr14 = std::max(maxErr14, std::abs(roots14[k] - std::log(params14[k]) / M_PI));
+        std::cout << "- " << workers << " workers: max error " << maxErr14
+                  << ", " << elapsed14.count() << " s" << std::endl;
+    }
+    std::cout << "- Simulated worker crashes: " << *crashed14 << std::endl;
+
+    // The first worker that meets the parameter 0.5 writes a partial result on its pipe and
+    // hangs: the coordinator must not block on the rest of the result
+    *crashed14 = 0;
+    SweepRunner::ProblemType hanging14{
+        [crashed14](const double p)
+        {
+            if (p == 0.5 && !__atomic_exchange_n(crashed14, 1, __ATOMIC_SEQ_CST))
+            {
+                const char partial[4]{};
+                for (int fd = 3; fd < 64; ++fd)
+                {
+                    struct stat info;
+                    if (fstat(fd, &info) == 0 && S_ISFIFO(info.st_mode) && (fcntl(fd, F_GETFL) & O_ACCMODE) == O_WRONLY)
+                        write(fd, partial, sizeof(partial));
+                }
+                sleep(60);
+            }
+            return std::log(p) / M_PI;
+        }};
+    std::vector<SolverTraits::ScalarType> params14_1{0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8};
+    auto start14 = std::chrono::steady_clock::now();
+    auto roots14 = SweepRunner(hanging14, 2, 2, 1.).run(params14_1);
+    std::chrono::duration<double> elapsed14 = std::chrono::steady_clock::now() - start14;
+    std::cout << "- Partial result and hang: p = 0.5 root " << roots14[4] << ", expected " << std::log(0.5) / M_PI
+              << (elapsed14.count() < 10. ? ", shard reassigned after the timeout" : ", the coordinator blocked") << std::endl;
+
+    // An exception that is not a std::exception ends the worker, whose shard is solved again
+    *crashed14 = 0;
+    SweepRunner::ProblemType throwing14{
+        [crashed14](const double p)
+        {
+            if (p == 0.5 && !__atomic_exchange_n(crashed14, 1, __ATOMIC_SEQ_CST))
+                throw 0;
+            return std::log(p) / M_PI;
+        }};
+    roots14 = SweepRunner(throwing14, 2, 2).run(params14_1);
+    std::cout << "- Worker ended by a non-standard exception: p = 0.5 root " << roots14[4] << ", expected "
+              << std::log(0.5) / M_PI << std::endl;
+
+    // A shard that fails on all the attempts stops the sweep, and no worker is left behind
+    SweepRunner::ProblemType dying14{[](const double p) -> double
+                                     { _exit(1); }};
+    try
+    {
+        SweepRunner(dying14, 2, 2, 1., 2).run(params14_1);
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    std::cout << "- Workers left after a failed sweep: " << (waitpid(-1, nullptr, WNOHANG) < 0 && errno == ECHILD ? "none" : "some")
+              << std::endl;
+    munmap(crashed14, sizeof(int));
+    std::cout << std::endl;
+
+    // MixedPrecision
+    std::cout << std::endl;
+    std::cout << "##################################################################" << std::endl;
+    std::cout << "# Test 15: MixedPrecision, float screening and double refinement #" << std::endl;
+    std::cout << "##################################################################" << std::endl;
+    std::cout << std::endl;
+
+    auto ff15 = [](const float x)
+    { return 0.5f - std::exp(static_cast<float>(M_PI) * x); };
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+    std::cout << "- Interval:      " << MixedPrecision::solve(ff15, f, std::array<double, 2>{-1, 0}, 1e-10) << std::endl;
+    std::cout << "- Point:         " << MixedPrecision::solve(ff15, f, -5., 1e-10) << std::endl;
+    std::cout << std::endl;
+
+    // Batch of problems x^3 + x - p = 0
+    auto fd15_1 = [](const double x, const double p)
+    { return x * x * x + x - p; };
+    std::vector<double> params15(200000);
+    for (std::size_t k = 0; k < params15.size(); ++k)
+        params15[k] = 0.5 + 9. * k / (params15.size() - 1);
+
+    auto start15 = std::chrono::steady_clock::now();
+    std::vector<double> roots15_D(params15.size());
+    for (std::size_t k = 0; k < params15.size(); ++k)
+        roots15_D[k] = SolverCore::brent([&fd15_1, p = params15[k]](const double x)
+                                         { return fd15_1(x, p); },
+                                         0., 2., 1e-10, 150);
+    std::chrono::duration<double> elapsed15_D = std::chrono::steady_clock::now() - start15;
+
+    start15 = std::chrono::steady_clock::now();
+    auto roots15_M = solveBatch15(params15);
+    std::chrono::duration<double> elapsed15_M = std::chrono::steady_clock::now() - start15;
+
+    double maxDiff15{0.};
+    for (std::size_t k = 0; k < params15.size(); ++k)
+        maxDiff15 = std::max(maxDiff15, std::abs(roots15_M[k] - roots15_D[k]));
+    std::cout << "Function: x^3 + x - p, " << params15.size() << " values of p" << std::endl;
+    std::cout << "- BrentSearch in double: " << elapsed15_D.count() << " s" << std::endl;
+    std::cout << "- MixedPrecision batch:  " << elapsed15_M.count() << " s, max difference " << maxDiff15 << std::endl;
+    std::cout << std::endl;
+
+    // Bracket handoff
+    std::cout << std::endl;
+    std::cout << "##############################################" << std::endl;
+    std::cout << "# Test 16: Bracket handoff, evaluations of f #" << std::endl;
+    std::cout << "##############################################" << std::endl;
+    std::cout << std::endl;
+
+    // f is wrapped to count the evaluations
+    unsigned int evaluations16{0u};
+    SolverTraits::FunctionType f16{
+        [&f, &evaluations16](const double x)
+        { ++evaluations16; return f(x); }};
+
+    // The ends of the bracket are evaluated by the bracketing helpers and handed to the solver
+    BrentSearch solver16_1(f16, std::array<SolverTraits::VariableType, 2>{-1, 0}, 1.e-10);
+    solver16_1.solve();
+    auto handoff16_1 = evaluations16;
+    // The same solve when the solver evaluates the ends again
+    evaluations16 = 0u;
+    auto bracket16_1 = checkChangeOfSign(f16, -1., 0.);
+    SolverCore::brent(f16, bracket16_1.a, bracket16_1.b, 1.e-10, 150);
+    std::cout << "Interval with change of sign:" << std::endl;
+    std::cout << "- Bracket handoff: " << handoff16_1 << " evaluations" << std::endl;
+    std::cout << "- Ends evaluated again: " << evaluations16 << " evaluations" << std::endl;
+    std::cout << std::endl;
+
+    evaluations16 = 0u;
+    BrentSearch solver16_2(f16, -5., 1.e-10);
+    solver16_2.solve();
+    auto handoff16_2 = evaluations16;
+    evaluations16 = 0u;
+    auto bracket16_2 = searchBracketInterval(f16, -5.);
+    SolverCore::brent(f16, bracket16_2.a, bracket16_2.b, 1.e-10, 150);
+    std::cout << "Interval searched from a point:" << std::endl;
+    std::cout << "- Bracket handoff: " << handoff16_2 << " evaluations" << std::endl;
+    std::cout << "- Ends evaluated again: " << evaluations16 << " evaluations" << std::endl;
+    std::cout << std::endl;
+
+    // PortfolioSolver
+    std::cout << std::endl;
+    std::cout << "#####################################################" << std::endl;
+    std::cout << "# Test 17: PortfolioSolver, concurrent solvers race #" << std::endl;
+    std::cout << "#####################################################" << std::endl;
+    std::cout << std::endl;
+
+    PortfolioSolver solver17(f, df, std::array<SolverTraits::VariableType, 2>{-1, 0}, 1e-8);
+    auto result17 = solver17.solve();
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+    std::cout << "- SolverBase:    " << result17 << " (" << solver17.getWinner() << ", "
+              << solver17.getEvaluations() << " evaluations)" << std::endl;
+    std::cout << std::endl;
+
+    // The bracketing solvers can not be used, f1 does not change sign
+    PortfolioSolver solver17_1(f1, std::array<SolverTraits::VariableType, 2>{-1, 0.3}, 1e-8);
+    auto result17_1 = solver17_1.solve();
+    std::cout << "Function: x^2" << std::endl;
+    std::cout << "- SolverBase:    " << result17_1 << " (" << solver17_1.getWinner() << ", "
+              << solver17_1.getEvaluations() << " evaluations)" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "#########################################################" << std::endl;
+    std::cout << "# Test 18: RootSensitivity, roots of perturbed problems #" << std::endl;
+    std::cout << "#########################################################" << std::endl;
+    std::cout << std::endl;
+
+    // f(x; p) = p - exp{pi*x}, the root is log(p)/pi and dx/dp = 1/(pi*p)
+    auto fp = [](const SolverTraits::VariableType &x, const SolverTraits::ScalarType &p)
+    { return p - std::exp(M_PI * x); };
+    auto builder18 = [&fp](const SolverTraits::ScalarType &p, const SolverTraits::VariableType &x0)
+    {
+        auto fx = [&fp, p](const SolverTraits::VariableType &x)
+        { return fp(x, p); };
+        auto dfx = [](const SolverTraits::VariableType &x)
+        { return -M_PI * std::exp(M_PI * x); };
+        return std::unique_ptr<SolverBase>(new Newton(fx, dfx, x0, 1e-12, 1e-14));
+    };
+    RootSensitivity sensitivity18(fp, builder18, 0.5, -0.2, 1e-6, 2);
+    std::cout << "Function: p - exp{pi*x}, p0 = 0.5" << std::endl;
+    std::cout << "- Expected dx/dp:  " << 1. / (M_PI * 0.5) << std::endl;
+    std::cout << "- RootSensitivity: " << sensitivity18.getDerivative() << std::endl;
+    std::cout << "- Expected d2x/dp2:  " << -1. / (M_PI * 0.25) << std::endl;
+    std::cout << "- RootSensitivity:   " << sensitivity18.getSecondDerivative() << std::endl;
+    double maxError18{0.};
+    for (unsigned int i = 0; i <= 100; ++i)
+    {
+        double p = 0.45 + 0.001 * i;
+        maxError18 = std::max(maxError18, std::abs(sensitivity18.solve(p) - std::log(p) / M_PI));
+    }
+    std::cout << "- Sweep of 101 parameters in [0.45, 0.55]: " << sensitivity18.getSolves()
+              << " solves, maximum error " << maxError18 << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "#######################################################" << std::endl;
+    std::cout << "# Test 19: ZeroCrossingScanner, roots of sampled data #" << std::endl;
+    std::cout << "#######################################################" << std::endl;
+    std::cout << std::endl;
+
+    // sin(x) + 0.3 sampled on [0, 1000], written to a binary file and memory-mapped
+    const double dx19 = 1e-2;
+    const std::size_t n19 = 100001;
+    const std::string path19 = "/tmp/main_test_samples.bin";
+    {
+        std::vector<double> samples19(n19);
+        for (std::size_t i = 0; i < n19; ++i)
+            samples19[i] = std::sin(i * dx19) + 0.3;
+        std::ofstream file19(path19, std::ios::binary);
+        file19.write(reinterpret_cast<const char *>(samples19.data()), n19 * sizeof(double));
+    }
+    // distance from the closest root of sin(x) + 0.3
+    auto error19 = [](double x)
+    {
+        double r = std::asin(-0.3);
+        double e1 = std::remainder(x - r, 2 * M_PI);
+        double e2 = std::remainder(x - (M_PI - r), 2 * M_PI);
+        return std::min(std::abs(e1), std::abs(e2));
+    };
+    std::cout << "Function: sin(x) + 0.3, " << n19 << " samples in [0, 1000]" << std::endl;
+    std::cout << "- Expected zero crossings: " << 2 * 159 << std::endl;
+    for (auto interpolation : {Interpolation::Linear, Interpolation::Cubic})
+    {
+        SampledFunction data19(path19, 0., dx19, interpolation);
+        ZeroCrossingScanner scanner19(data19, 1e-12);
+        auto roots19 = scanner19.solveAll();
+        double maxError19{0.};
+        for (auto x : roots19)
+            maxError19 = std::max(maxError19, error19(x));
+        std::cout << "- " << (interpolation == Interpolation::Linear ? "Linear" : "Cubic ")
+                  << " interpolation: " << roots19.size() << " crossings, maximum error "
+                  << maxError19 << std::endl;
+    }
+    std::remove(path19.c_str());
+    std::cout << std::endl;
+
+    std::cout << "#######################################################" << std::endl;
+    std::cout << "# Test 20: PolicySolver, solvers composed of policies #" << std::endl;
+    std::cout << "#######################################################" << std::endl;
+    std::cout << std::endl;
+
+    std::array<SolverTraits::VariableType, 2> interval20{-1, 0};
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+    auto print20 = [](const std::string &name, SolverBase &solver)
+    {
+        auto result = solver.solve();
+        std::cout << "- " << std::left << std::setw(18) << name << result << " ("
+                  << solver.getReport().iterations << " iterations)" << std::endl;
+    };
+    // The solvers of Solvers.hpp are compositions of policies
+    Bisection bisection20(f, interval20, 1e-8);
+    RegulaFalsi regulaFalsi20(f, interval20, 1e-8, 1e-10);
+    BrentSearch brent20(f, interval20, 1e-8);
+    Secant secant20(f, interval20, 1e-8, 1e-10);
+    Newton newton20(f, df, 0., 1e-8, 1e-10);
+    // New compositions: secant through the last two iterates instead of the fixed end
+    PolicySolver<Policies::SecantStep, Policies::NoSafeguard, Policies::Residual> twoPointSecant20(f, interval20, 1e-8, 1e-10);
+    // Newton alone diverges from x = 1, where exp{pi*x} is too steep
+    SafeNewton safeNewton20(f, df, std::array<SolverTraits::VariableType, 2>{-1, 1}, 1e-8, 1e-10);
+    SafeNewton safeNewton20_1(f, df, std::array<SolverTraits::VariableType, 2>{-1, 1}, 1e-12, 1e-14);
+    // five secant steps kept in the bracket
+    PolicySolver<Policies::SecantStep, Policies::Bracketing, Policies::Budget<5>> budget20(f, interval20);
+    print20("Bisection", bisection20);
+    print20("RegulaFalsi", regulaFalsi20);
+    print20("BrentSearch", brent20);
+    print20("Secant", secant20);
+    print20("Newton", newton20);
+    print20("Two-point secant", twoPointSecant20);
+    print20("SafeNewton", safeNewton20);
+    print20("SafeNewton, 1e-12", safeNewton20_1);
+    print20("Secant, budget 5", budget20);
+    // moving one end of the bracket forgets only the value of f at that end
+    unsigned int evaluations20{0u};
+    Bisection moved20([&](const double x)
+                      { ++evaluations20; return f(x); }, interval20, 1e-8);
+    moved20.setB(-0.1);
+    evaluations20 = 0u;
+    print20("Bisection, new b", moved20);
+    std::cout << "  " << evaluations20 << " evaluations of f, one at the new end" << std::endl;
+    std::cout << std::right << std::endl;
+
+    std::cout << "#########################################################" << std::endl;
+    std::cout << "# Test 21: SolverDaemon, solves served on a Unix socket #" << std::endl;
+    std::cout << "#########################################################" << std::endl;
+    std::cout << std::endl;
+
+    // one worker, so that the requests are solved in order
+    SolverDaemon daemon21("/tmp/main_test_daemon.sock", 1);
+    daemon21.registerFunction(0u, [](const double &x, const double &p)
+                              { return p - std::exp(M_PI * x); });
+    daemon21.start();
+    {
+        SolverClient client21(daemon21.getPath());
+        auto report21 = client21.solve(0u, 0.5, std::array<SolverTraits::VariableType, 2>{-1, 0}, 1e-10);
+        std::cout << "Function: p - exp{pi*x}, p = 0.5" << std::endl;
+        std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+        std::cout << "- SolverDaemon:  " << report21.root << " (" << report21.iterations << " iterations)" << std::endl;
+
+        // the second client starts from the root of the closest parameter already solved
+        SolverClient client21_1(daemon21.getPath());
+        std::vector<DaemonProtocol::Request> batch21;
+        for (double p : {0.55, 0.6})
+            batch21.push_back({0u, 0u, p, 0., 0., 1e-10});
+        // a repeated request is answered by the evaluation cache
+        batch21.push_back({0u, 0u, 0.5, -1., 0., 1e-10});
+        auto responses21 = client21_1.solve(batch21);
+        for (unsigned int i = 0; i < batch21.size(); ++i)
+            std::cout << "- p = " << batch21[i].param << ": " << responses21[i].root << ", expected "
+                      << std::log(batch21[i].param) / M_PI << " (" << responses21[i].evaluations
+                      << " new evaluations)" << std::endl;
+
+        try
+        {
+            client21.solve(7u, 0.5, 0.);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << e.what() << std::endl;
+        }
+
+        // a second daemon does not take the socket of the running one
+        SolverDaemon second21(daemon21.getPath(), 1);
+        try
+        {
+            second21.start();
+            std::cout << "- The socket of the running daemon has been replaced" << std::endl;
+        }
+        catch (const std::runtime_error &e)
+        {
+            std::cout << "- Second daemon: " << e.what() << std::endl;
+        }
+        struct stat info21;
+        if (stat(daemon21.getPath().c_str(), &info21) == 0)
+            std::cout << "- Permissions of the socket: " << std::oct << (info21.st_mode & 0777) << std::dec << std::endl;
+    }
+    daemon21.stop();
+    // a file that is not a socket is never removed
+    std::ofstream("/tmp/main_test_daemon.sock") << "not a socket";
+    try
+    {
+        daemon21.start();
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cout << "- " << e.what() << std::endl;
+    }
+    std::remove("/tmp/main_test_daemon.sock");
+    // the socket left by a daemon that crashed is replaced
+    {
+        sockaddr_un address21{};
+        address21.sun_family = AF_UNIX;
+        std::strcpy(address21.sun_path, "/tmp/main_test_daemon.sock");
+        int fd21 = socket(AF_UNIX, SOCK_STREAM, 0);
+        bind(fd21, reinterpret_cast<sockaddr *>(&address21), sizeof(address21));
+        close(fd21);
+        SolverDaemon restarted21("/tmp/main_test_daemon.sock", 1);
+        restarted21.registerFunction(0u, [](const double &x, const double &p)
+                                     { return p - std::exp(M_PI * x); });
+        restarted21.start();
+        SolverClient client21(restarted21.getPath());
+        std::cout << "- Stale socket replaced, p = 0.5: "
+                  << client21.solve(0u, 0.5, std::array<SolverTraits::VariableType, 2>{-1, 0}, 1e-10).root << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::cout << "###########################################################" << std::endl;
+    std::cout << "# Test 22: RootCache, persistent cache of solved problems #" << std::endl;
+    std::cout << "###########################################################" << std::endl;
+    std::cout << std::endl;
+
+    const std::string path22 = "/tmp/main_test_roots.cache";
+    std::remove(path22.c_str());
+    auto fp22 = [](double x, double p)
+    { return p - std::exp(M_PI * x); };
+    unsigned int builds22{0u};
+    auto solve22 = [&](RootCache &cache, double p)
+    {
+        return cache.solve(0u, p, {-1., 0.}, 1e-10, [&]
+                           {
+            ++builds22;
+            SolverTraits::FunctionType fx = [&fp22, p](double x) { return fp22(x, p); };
+            return std::unique_ptr<SolverBase>(new BrentSearch(fx, std::array<SolverTraits::VariableType, 2>{-1., 0.}, 1e-10)); });
+    };
+    {
+        RootCache cache22(path22, 1024);
+        for (double p : {0.4, 0.5, 0.6, 0.5})
+            solve22(cache22, p);
+        std::cout << "First run: 4 solves, " << builds22 << " solvers built" << std::endl;
+    }
+    // two processes write to the cache at the same time
+    for (unsigned int child = 0; child < 2; ++child)
+        if (fork() == 0)
+        {
+            RootCache cache22(path22);
+            for (unsigned int i = 1; i <= 50; ++i)
+                solve22(cache22, 0.1 + 0.3 * child + 0.0049 * i);
+            _exit(0);
+        }
+    while (wait(nullptr) > 0)
+        ;
+    {
+        // a new run finds the problems solved by the previous ones
+        RootCache cache22(path22);
+        builds22 = 0u;
+        auto report22 = solve22(cache22, 0.5);
+        std::cout << "Second run: - p = 0.5: " << report22.root << ", expected " << std::log(0.5) / M_PI
+                  << " (" << builds22 << " solvers built, " << report22.iterations << " iterations when solved)" << std::endl;
+        std::cout << "            - " << cache22.size() << " problems in the cache" << std::endl;
+
+        // a nearby problem starts from a tight bracket
+        SolverTraits::FunctionType fx22 = [&fp22](double x)
+        { return fp22(x, 0.503); };
+        auto bracket22 = cache22.nearby(0u, 0.503, fx22);
+        if (bracket22)
+        {
+            BrentSearch solver22(fx22, *bracket22, 1e-10);
+            auto root22 = solver22.solve();
+            std::cout << "            - p = 0.503: bracket of width " << bracket22->b - bracket22->a << ", root "
+                      << root22 << ", expected " << std::log(0.503) / M_PI << " ("
+                      << solver22.getReport().iterations << " iterations)" << std::endl;
+        }
+    }
+
+    // a file whose capacity is not a power of two is rejected. The size of a slot and of the
+    // header are measured on two new caches, the capacity is the third field of the header
+    {
+        struct stat one22, two22;
+        std::remove(path22.c_str());
+        { RootCache cache22(path22, 1); }
+        stat(path22.c_str(), &one22);
+        std::remove(path22.c_str());
+        { RootCache cache22(path22, 2); }
+        stat(path22.c_str(), &two22);
+        off_t slot22 = two22.st_size - one22.st_size;
+        std::uint64_t capacity22 = 3u;
+        int fd22 = open(path22.c_str(), O_WRONLY);
+        if (pwrite(fd22, &capacity22, sizeof(capacity22), 16) != sizeof(capacity22) ||
+            ftruncate(fd22, one22.st_size + 2 * slot22) != 0)
+            std::cout << "It was not possible to write the cache" << std::endl;
+        close(fd22);
+        try
+        {
+            RootCache cache22(path22);
+            std::cout << "A cache of capacity 3 was accepted" << std::endl;
+        }
+        catch (const std::runtime_error &e)
+        {
+            std::cout << "Capacity 3: " << e.what() << std::endl;
+        }
+    }
+    std::remove(path22.c_str());
+    std::cout << std::endl;
+
+    std::cout << "################################################" << std::endl;
+    std::cout << "# Test 23: PolicySolver, checkpoint and resume #" << std::endl;
+    std::cout << "################################################" << std::endl;
+    std::cout << std::endl;
+
+    // The evaluations are counted, and the node fails after a given number of them
+    unsigned int evaluations23{0u};
+    unsigned int failure23{0u};
+    auto count23 = [&](const SolverTraits::FunctionType &g)
+    {
+        return SolverTraits::FunctionType([&, g](const double x)
+                                          {
+            if (evaluations23 + 1 == failure23)
+                throw std::runtime_error("Node restarted");
+            ++evaluations23;
+            return g(x); });
+    };
+    const std::string path23 = "/tmp/main_test_checkpoint.bin";
+    auto run23 = [&](auto solver, const std::string &name, unsigned int failure)
+    {
+        std::remove(path23.c_str());
+        evaluations23 = 0u;
+        failure23 = 0u;
+        auto reference = solver.solve();
+        unsigned int referenceEvaluations = evaluations23;
+
+        evaluations23 = 0u;
+        failure23 = failure;
+        solver.setCheckpoint(path23);
+        try
+        {
+            solver.solve();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << e.what() << " after " << evaluations23 << " evaluations" << std::endl;
+        }
+        // a new solver resumes from the checkpoint
+        failure23 = 0u;
+        auto resumed = solver;
+        auto result = resumed.solve();
+        std::cout << "- " << std::left << std::setw(12) << name << result << " (" << evaluations23
+                  << " evaluations), without interruptions " << reference << " (" << referenceEvaluations
+                  << " evaluations)" << std::right << std::endl;
+        // the checkpoint of a successful solve is removed
+        if (access(path23.c_str(), F_OK) == 0)
+            std::cout << "  the checkpoint has not been removed" << std::endl;
+        std::remove(path23.c_str());
+    };
+    std::cout << "Function: 0.5 - exp{pi*x}" << std::endl;
+    std::cout << "- Expected zero: " << std::log(0.5) / M_PI << std::endl;
+    run23(PolicyBrent(count23(f), interval20, 1e-10), "PolicyBrent", 5);
+    run23(SafeNewton(count23(f), count23(df), std::array<SolverTraits::VariableType, 2>{-1, 1}, 1e-10), "SafeNewton", 6);
+    // the solvers are compositions of policies, so they are checkpointed too
+    run23(BrentSearch(count23(f), interval20, 1e-10), "BrentSearch", 5);
+    run23(Bisection(count23(f), interval20, 1e-10), "Bisection", 10);
+
+    // a checkpoint of another composition of the same problem is rejected
+    PolicyBrent brent23(count23(f), interval20, 1e-10);
+    brent23.setCheckpoint(path23);
+    evaluations23 = 0u;
+    failure23 = 5u;
+    try
+    {
+        brent23.solve();
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << " after " << evaluations23 << " evaluations" << std::endl;
+    }
+    failure23 = 0u;
+    PolicyRegulaFalsi regulaFalsi23(count23(f), interval20, 1e-10);
+    regulaFalsi23.setCheckpoint(path23);
+    try
+    {
+        regulaFalsi23.solve();
+        std::cout << "- The checkpoint of PolicyBrent has been accepted by PolicyRegulaFalsi" << std::endl;
+    }
+    catch (const std::invalid_argument &e)
+    {
+        std::cout << "- PolicyRegulaFalsi: " << e.what() << std::endl;
+    }
+    std::remove(path23.c_str());
+
+    // ModifiedNewton has its own loop, a checkpoint would be silently ignored
+    ModifiedNewton modifiedNewton23(f, df, 0., 1e-10);
+    PolicyNewton &policyNewton23 = modifiedNewton23;
+    try
+    {
+        policyNewton23.setCheckpoint(path23);
+        std::cout << "- ModifiedNewton accepted a checkpoint" << std::endl;
+    }
+    catch (const std::invalid_argument &e)
+    {
+        std::cout << "- ModifiedNewton: " << e.what() << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::cout << "##########################################################" << std::endl;
+    std::cout << "# Test 24: the solvers reproduce the loops they replaced #" << std::endl;
+    std::cout << "##########################################################" << std::endl;
+    std::cout << std::endl;
+
+    static_assert(std::is_base_of_v<PolicySecant, Secant> && std::is_base_of_v<PolicyBisection, Bisection> &&
+                  std::is_base_of_v<PolicyRegulaFalsi, RegulaFalsi> && std::is_base_of_v<PolicyBrent, BrentSearch> &&
+                  std::is_base_of_v<PolicyNewton, Newton>);
+
+    // Iterations, evaluations of f and df, root and FNV-1a hash of the evaluation points of the
+    // loops of each solver, recorded before they were replaced by the compositions of policies
+    // (BrentSearch after its acceptance bound was corrected from 3 (a + b) / 4 to (3a + b) / 4)
+    struct Reference24
+    {
+        std::string name;
+        unsigned int iterations;
+        unsigned int evaluations;
+        double root;
+        std::uint64_t hash;
+    };
+    const std::vector<Reference24> references24{
+        // 0.5 - exp{pi*x}
+        {"Secant", 17, 19, -0x1.c3dc9943dc597p-3, 0x0800deb6b68245deull},
+        {"Bisection", 26, 28, -0x1.c3dc99p-3, 0xcc0c75989dbb8521ull},
+        {"RegulaFalsi", 17, 19, -0x1.c3dc9943dc597p-3, 0xa05103ccc670d9c3ull},
+        {"BrentSearch", 17, 19, -0x1.c3dc98f7e969bp-3, 0x8089541fe7a18b3full},
+        {"Newton", 5, 11, -0x1.c3dc98f7e969cp-3, 0x168b697372348bb5ull},
+        {"QuasiNewton", 5, 16, -0x1.c3dc98f7e95bcp-3, 0x98d84d366b08d002ull},
+        // x^3 - 2x - 5
+        {"Secant", 24, 26, 0x1.0c1a43507f821p+1, 0xea17291a89a45539ull},
+        {"Bisection", 33, 35, 0x1.0c1a4350ap+1, 0x72b0c1ac11ef2647ull},
+        {"RegulaFalsi", 21, 23, 0x1.0c1a43505767ep+1, 0xefe633b45ac00870ull},
+        {"BrentSearch", 36, 38, 0x1.0c1a4350adc78p+1, 0x34003a5d7671d888ull},
+        {"Newton", 4, 9, 0x1.0c1a4350819e3p+1, 0x4613e8fa2979afdbull},
+        {"QuasiNewton", 4, 13, 0x1.0c1a4350819e3p+1, 0x0e3bba6be442b77bull},
+        // cos(x) - x
+        {"Secant", 5, 7, 0x1.7a6952132dc5cp-1, 0x5a601b52ce06e18eull},
+        {"Bisection", 19, 21, 0x1.7a696p-1, 0x1167db3968fe98d1ull},
+        {"RegulaFalsi", 5, 7, 0x1.7a6952132dc5cp-1, 0x5a601b52ce06e18eull},
+        {"BrentSearch", 21, 23, 0x1.7a6973b22bbd6p-1, 0xcf2e481d59bcf0c3ull},
+        {"Newton", 3, 7, 0x1.7a695dd9b2fddp-1, 0xd86cff4c3ca76e12ull},
+        {"QuasiNewton", 3, 10, 0x1.7a695dd9aedfbp-1, 0x594c162e54394513ull},
+    };
+    struct Problem24
+    {
+        std::string name;
+        SolverTraits::FunctionType f, df;
+        std::array<SolverTraits::VariableType, 2> interval;
+        SolverTraits::VariableType x0;
+        double tol, tola;
+    };
+    const std::vector<Problem24> problems24{
+        {"0.5 - exp{pi*x}", f, df, {-1, 0}, 0., 1e-8, 1e-10},
+        {"x^3 - 2x - 5", [](const double x)
+         { return x * x * x - 2 * x - 5; },
+         [](const double x)
+         { return 3 * x * x - 2; },
+         {2, 3}, 2., 1e-10, 1e-12},
+        {"cos(x) - x", [](const double x)
+         { return std::cos(x) - x; },
+         [](const double x)
+         { return -std::sin(x) - 1; },
+         {0, 1}, 1., 1e-6, 1e-10}};
+
+    // The evaluation points are hashed in the order of the evaluations
+    unsigned int evaluations24{0u};
+    std::uint64_t hash24{0u};
+    auto record24 = [&](const SolverTraits::FunctionType &g)
+    {
+        return SolverTraits::FunctionType([&, g](const double x)
+                                          {
+            ++evaluations24;
+            unsigned char bytes[sizeof(double)];
+            std::memcpy(bytes, &x, sizeof(double));
+            for (unsigned char byte : bytes)
+                hash24 = (hash24 ^ byte) * 1099511628211ull;
+            return g(x); });
+    };
+    auto it24 = references24.begin();
+    for (const auto &problem : problems24)
+    {
+        std::cout << "Function: " << problem.name << std::endl;
+        auto check24 = [&](const std::function<std::unique_ptr<SolverBase>()> &build)
+        {
+            evaluations24 = 0u;
+            hash24 = 1469598103934665603ull;
+            auto solver = build();
+            auto root = solver->solve();
+            const auto &report = solver->getReport();
+            bool same = report.iterations == it24->iterations && evaluations24 == it24->evaluations &&
+                        root == it24->root && hash24 == it24->hash;
+            std::cout << "- " << std::left << std::setw(12) << it24->name << std::right << std::setw(2)
+                      << report.iterations << " iterations, " << std::setw(2) << evaluations24
+                      << " evaluations: " << (same ? "same iterates" : "DIFFERENT iterates") << std::endl;
+            ++it24;
+        };
+        check24([&]
+                { return std::make_unique<Secant>(record24(problem.f), problem.interval, problem.tol, problem.tola); });
+        check24([&]
+                { return std::make_unique<Bisection>(record24(problem.f), problem.interval, problem.tol); });
+        check24([&]
+                { return std::make_unique<RegulaFalsi>(record24(problem.f), problem.interval, problem.tol, problem.tola); });
+        check24([&]
+                { return std::make_unique<BrentSearch>(record24(problem.f), problem.interval, problem.tol); });
+        check24([&]
+                { return std::make_unique<Newton>(record24(problem.f), record24(problem.df), problem.x0, problem.tol, problem.tola); });
+        check24([&]
+                { return std::make_unique<QuasiNewton>(record24(problem.f), problem.x0, problem.tol, problem.tola); });
+        std::cout << std::endl;
+    }
+
     return 0;
-}
\ No newline at end of file
+}